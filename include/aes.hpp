@@ -7,6 +7,9 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
 #include <vector>
 
 namespace aes
@@ -312,12 +315,22 @@ namespace aes
                         words[i].bytes[j] ^= roundKey[j].bytes[i];
             }
 
-            template <std::size_t keyLength, class Key>
-            void encrypt(const Key& key) noexcept
+            // a partial block is padded with zeros
+            void load(const std::uint8_t* data, const std::size_t size) noexcept
             {
-                RoundKeys<keyLength> roundKeys;
-                expandKey<keyLength>(key, roundKeys);
+                for (std::size_t i = 0; i < blockByteCount; ++i)
+                    words[i / wordByteCount].bytes[i % wordByteCount] = i < size ? data[i] : 0;
+            }
+
+            void store(std::uint8_t* data) const noexcept
+            {
+                for (std::size_t i = 0; i < blockByteCount; ++i)
+                    data[i] = words[i / wordByteCount].bytes[i % wordByteCount];
+            }
 
+            template <std::size_t keyLength>
+            void encrypt(const RoundKeys<keyLength>& roundKeys) noexcept
+            {
                 Block state;
                 for (std::size_t i = 0; i < wordByteCount; ++i)
                     for (std::size_t j = 0; j < blockWordCount; ++j)
@@ -342,12 +355,9 @@ namespace aes
                         words[j].bytes[i] = state.words[i].bytes[j];
             }
 
-            template <std::size_t keyLength, class Key>
-            void decrypt(const Key& key) noexcept
+            template <std::size_t keyLength>
+            void decrypt(const RoundKeys<keyLength>& roundKeys) noexcept
             {
-                RoundKeys<keyLength> roundKeys;
-                expandKey<keyLength>(key, roundKeys);
-
                 Block state;
                 for (std::size_t i = 0; i < wordByteCount; ++i)
                     for (std::size_t j = 0; j < blockWordCount; ++j)
@@ -375,72 +385,192 @@ namespace aes
             Word words[blockWordCount];
         };
 
-        template <class Iterator>
-        std::vector<Block> convertToBlocks(Iterator begin, Iterator end)
+        template <class InitVector>
+        Block loadInitVector(const InitVector& initVector) noexcept
         {
-            std::vector<Block> result;
+            Block result;
+            auto initVectorIterator = std::begin(initVector);
+            for (auto& w : result.words)
+                for (auto& b : w.bytes)
+                    b = static_cast<std::uint8_t>(*initVectorIterator++);
+            return result;
+        }
+    }
 
-            std::size_t byte = 0;
-            for (auto i = begin; i != end; ++i)
-            {
-                if (result.size() < byte / blockByteCount + 1)
-                    result.resize(byte / blockByteCount + 1);
+    // size of the output for size bytes of input, the last block is padded with zeros
+    constexpr std::size_t paddedSize(const std::size_t size) noexcept
+    {
+        return (size + blockByteCount - 1) / blockByteCount * blockByteCount;
+    }
 
-                Block& block = result[byte / blockByteCount];
-                Word& word = block.words[(byte / wordByteCount) % blockWordCount];
-                word.bytes[byte % wordByteCount] = static_cast<std::uint8_t>(*i);
-                ++byte;
-            }
+    // The pointer overloads write paddedSize(size) bytes to output and return the number written.
+    // The output may be the same buffer as the input.
+    template <std::size_t keyLength, class T, class Key, std::enable_if_t<sizeof(T) == 1>* = nullptr>
+    std::size_t encryptEcb(const T* input, const std::size_t size, std::uint8_t* output, const Key& key) noexcept
+    {
+        RoundKeys<keyLength> roundKeys;
+        expandKey<keyLength>(key, roundKeys);
 
-            return result;
+        const auto data = reinterpret_cast<const std::uint8_t*>(input);
+        for (std::size_t offset = 0; offset < size; offset += blockByteCount)
+        {
+            Block block;
+            block.load(data + offset, size - offset);
+            block.encrypt<keyLength>(roundKeys);
+            block.store(output + offset);
         }
+
+        return paddedSize(size);
     }
 
-    template <std::size_t keyLength, class Iterator, class Key>
-    std::vector<std::uint8_t> encryptEcb(Iterator begin, Iterator end, const Key& key)
+    template <std::size_t keyLength, class T, class Key, std::enable_if_t<sizeof(T) == 1>* = nullptr>
+    std::size_t decryptEcb(const T* input, const std::size_t size, std::uint8_t* output, const Key& key) noexcept
     {
-        std::vector<Block> blocks = convertToBlocks(begin, end);
-        std::vector<std::uint8_t> result(blocks.size() * blockByteCount);
+        RoundKeys<keyLength> roundKeys;
+        expandKey<keyLength>(key, roundKeys);
 
-        auto resultIterator = result.begin();
+        const auto data = reinterpret_cast<const std::uint8_t*>(input);
+        for (std::size_t offset = 0; offset < size; offset += blockByteCount)
+        {
+            Block block;
+            block.load(data + offset, size - offset);
+            block.decrypt<keyLength>(roundKeys);
+            block.store(output + offset);
+        }
+
+        return paddedSize(size);
+    }
 
-        for (auto& block : blocks)
+    template <std::size_t keyLength, class T, class Key, class InitVector, std::enable_if_t<sizeof(T) == 1>* = nullptr>
+    std::size_t encryptCbc(const T* input, const std::size_t size, std::uint8_t* output, const Key& key,
+                           const InitVector& initVector) noexcept
+    {
+        RoundKeys<keyLength> roundKeys;
+        expandKey<keyLength>(key, roundKeys);
+
+        Block dataBlock = loadInitVector(initVector);
+
+        const auto data = reinterpret_cast<const std::uint8_t*>(input);
+        for (std::size_t offset = 0; offset < size; offset += blockByteCount)
         {
-            block.encrypt<keyLength>(key);
+            Block block;
+            block.load(data + offset, size - offset);
+            dataBlock ^= block;
+            dataBlock.encrypt<keyLength>(roundKeys);
+            dataBlock.store(output + offset);
+        }
+
+        return paddedSize(size);
+    }
+
+    template <std::size_t keyLength, class T, class Key, class InitVector, std::enable_if_t<sizeof(T) == 1>* = nullptr>
+    std::size_t decryptCbc(const T* input, const std::size_t size, std::uint8_t* output, const Key& key,
+                           const InitVector& initVector) noexcept
+    {
+        RoundKeys<keyLength> roundKeys;
+        expandKey<keyLength>(key, roundKeys);
+
+        Block dataBlock = loadInitVector(initVector);
 
-            // copy the block to output
-            for (const auto w : block.words)
-                for (const auto b : w.bytes)
-                    *resultIterator++ = b;
+        const auto data = reinterpret_cast<const std::uint8_t*>(input);
+        for (std::size_t offset = 0; offset < size; offset += blockByteCount)
+        {
+            // the ciphertext is kept before the output overwrites it
+            Block cipherBlock;
+            cipherBlock.load(data + offset, size - offset);
+            Block block = cipherBlock;
+            block.decrypt<keyLength>(roundKeys);
+            block ^= dataBlock;
+            block.store(output + offset);
+            dataBlock = cipherBlock;
         }
 
-        return result;
+        return paddedSize(size);
     }
 
-    template <std::size_t keyLength, class Data, class Key>
-    std::vector<std::uint8_t> encryptEcb(const Data& data, const Key& key)
+    template <std::size_t keyLength, class T, class Key, class InitVector, std::enable_if_t<sizeof(T) == 1>* = nullptr>
+    std::size_t encryptCfb(const T* input, const std::size_t size, std::uint8_t* output, const Key& key,
+                           const InitVector& initVector) noexcept
     {
-        return encryptEcb<keyLength>(std::begin(data), std::end(data), key);
+        RoundKeys<keyLength> roundKeys;
+        expandKey<keyLength>(key, roundKeys);
+
+        Block encryptedBlock = loadInitVector(initVector);
+
+        const auto data = reinterpret_cast<const std::uint8_t*>(input);
+        for (std::size_t offset = 0; offset < size; offset += blockByteCount)
+        {
+            Block block;
+            block.load(data + offset, size - offset);
+            encryptedBlock.encrypt<keyLength>(roundKeys);
+            encryptedBlock ^= block;
+            encryptedBlock.store(output + offset);
+        }
+
+        return paddedSize(size);
     }
 
-    template <std::size_t keyLength, class Iterator, class Key>
-    std::vector<std::uint8_t> decryptEcb(Iterator begin, Iterator end, const Key& key)
+    template <std::size_t keyLength, class T, class Key, class InitVector, std::enable_if_t<sizeof(T) == 1>* = nullptr>
+    std::size_t decryptCfb(const T* input, const std::size_t size, std::uint8_t* output, const Key& key,
+                           const InitVector& initVector) noexcept
     {
-        std::vector<Block> blocks = convertToBlocks(begin, end);
-        std::vector<std::uint8_t> result(blocks.size() * blockByteCount);
+        RoundKeys<keyLength> roundKeys;
+        expandKey<keyLength>(key, roundKeys);
 
-        auto resultIterator = result.begin();
+        Block decryptedBlock = loadInitVector(initVector);
 
-        for (auto& block : blocks)
+        const auto data = reinterpret_cast<const std::uint8_t*>(input);
+        for (std::size_t offset = 0; offset < size; offset += blockByteCount)
+        {
+            Block block;
+            block.load(data + offset, size - offset);
+            decryptedBlock.encrypt<keyLength>(roundKeys);
+            decryptedBlock ^= block;
+            decryptedBlock.store(output + offset);
+            decryptedBlock = block;
+        }
+
+        return paddedSize(size);
+    }
+
+    inline namespace detail
+    {
+        // copies the input into a buffer of whole blocks for the pointer overloads to work on in place
+        template <class Iterator>
+        std::vector<std::uint8_t> toBuffer(const Iterator begin, const Iterator end)
         {
-            block.decrypt<keyLength, Key>(key);
+            std::vector<std::uint8_t> result;
+            if constexpr (std::is_base_of_v<std::random_access_iterator_tag,
+                                            typename std::iterator_traits<Iterator>::iterator_category>)
+                result.reserve(paddedSize(static_cast<std::size_t>(end - begin)));
 
-            // copy the block to output
-            for (const auto word : block.words)
-                for (const auto byte : word.bytes)
-                    *resultIterator++ = byte;
+            for (auto i = begin; i != end; ++i)
+                result.push_back(static_cast<std::uint8_t>(*i));
+
+            result.resize(paddedSize(result.size()));
+            return result;
         }
+    }
+
+    template <std::size_t keyLength, class Iterator, class Key>
+    std::vector<std::uint8_t> encryptEcb(Iterator begin, Iterator end, const Key& key)
+    {
+        auto result = toBuffer(begin, end);
+        encryptEcb<keyLength>(result.data(), result.size(), result.data(), key);
+        return result;
+    }
+
+    template <std::size_t keyLength, class Data, class Key>
+    std::vector<std::uint8_t> encryptEcb(const Data& data, const Key& key)
+    {
+        return encryptEcb<keyLength>(std::begin(data), std::end(data), key);
+    }
 
+    template <std::size_t keyLength, class Iterator, class Key>
+    std::vector<std::uint8_t> decryptEcb(Iterator begin, Iterator end, const Key& key)
+    {
+        auto result = toBuffer(begin, end);
+        decryptEcb<keyLength>(result.data(), result.size(), result.data(), key);
         return result;
     }
 
@@ -454,29 +584,8 @@ namespace aes
     std::vector<std::uint8_t> encryptCbc(Iterator begin, Iterator end, const Key& key,
                                          const InitVector& initVector)
     {
-        std::vector<Block> blocks = convertToBlocks(begin, end);
-        std::vector<std::uint8_t> result(blocks.size() * blockByteCount);
-
-        Block dataBlock;
-
-        auto initVectorIterator = std::begin(initVector);
-        for (auto& w : dataBlock.words)
-            for (auto& b : w.bytes)
-                b = *initVectorIterator++;
-
-        auto resultIterator = result.begin();
-
-        for (const auto& block : blocks)
-        {
-            dataBlock ^= block;
-            dataBlock.encrypt<keyLength>(key);
-
-            // copy the block to output
-            for (const auto w : dataBlock.words)
-                for (const auto b : w.bytes)
-                    *resultIterator++ = b;
-        }
-
+        auto result = toBuffer(begin, end);
+        encryptCbc<keyLength>(result.data(), result.size(), result.data(), key, initVector);
         return result;
     }
 
@@ -491,35 +600,8 @@ namespace aes
     std::vector<std::uint8_t> decryptCbc(Iterator begin, Iterator end, const Key& key,
                                          const InitVector& initVector)
     {
-        std::vector<Block> blocks = convertToBlocks(begin, end);
-        std::vector<std::uint8_t> result(blocks.size() * blockByteCount);
-
-        Block dataBlock;
-
-        auto initVectorIterator = std::begin(initVector);
-        for (auto& w : dataBlock.words)
-            for (auto& b : w.bytes)
-                b = *initVectorIterator++;
-
-        auto dataIterator = begin;
-        auto resultIterator = result.begin();
-
-        for (auto& block : blocks)
-        {
-            block.decrypt<keyLength>(key);
-            block ^= dataBlock;
-
-            // copy the block to output
-            for (const auto w : block.words)
-                for (const auto b : w.bytes)
-                    *resultIterator++ = b;
-
-            // copy the data to data block
-            for (auto& w : dataBlock.words)
-                for (auto& b : w.bytes)
-                    b = *dataIterator++;
-        }
-
+        auto result = toBuffer(begin, end);
+        decryptCbc<keyLength>(result.data(), result.size(), result.data(), key, initVector);
         return result;
     }
 
@@ -534,29 +616,8 @@ namespace aes
     std::vector<std::uint8_t> encryptCfb(Iterator begin, Iterator end, const Key& key,
                                          const InitVector& initVector)
     {
-        std::vector<Block> blocks = convertToBlocks(begin, end);
-        std::vector<std::uint8_t> result(blocks.size() * blockByteCount);
-
-        Block encryptedBlock;
-
-        auto initVectorIterator = std::begin(initVector);
-        for (auto& w : encryptedBlock.words)
-            for (auto& b : w.bytes)
-                b = static_cast<std::uint8_t>(*initVectorIterator++);
-
-        auto resultIterator = result.begin();
-
-        for (const auto& block : blocks)
-        {
-            encryptedBlock.encrypt<keyLength>(key);
-            encryptedBlock ^= block;
-
-            // copy the block to output
-            for (const auto w : encryptedBlock.words)
-                for (const auto b : w.bytes)
-                    *resultIterator++ = b;
-        }
-
+        auto result = toBuffer(begin, end);
+        encryptCfb<keyLength>(result.data(), result.size(), result.data(), key, initVector);
         return result;
     }
 
@@ -571,31 +632,8 @@ namespace aes
     std::vector<std::uint8_t> decryptCfb(Iterator begin, Iterator end, const Key& key,
                                          const InitVector& initVector)
     {
-        std::vector<Block> blocks = convertToBlocks(begin, end);
-        std::vector<std::uint8_t> result(blocks.size() * blockByteCount);
-
-        Block decryptedBlock;
-
-        auto initVectorIterator = std::begin(initVector);
-        for (auto& w : decryptedBlock.words)
-            for (auto& b : w.bytes)
-                b = *initVectorIterator++;
-
-        auto resultIterator = result.begin();
-
-        for (const auto& block : blocks)
-        {
-            decryptedBlock.encrypt<keyLength>(key);
-            decryptedBlock ^= block;
-
-            // copy the block to output
-            for (const auto w : decryptedBlock.words)
-                for (const auto b : w.bytes)
-                    *resultIterator++ = b;
-
-            decryptedBlock = block;
-        }
-
+        auto result = toBuffer(begin, end);
+        decryptCfb<keyLength>(result.data(), result.size(), result.data(), key, initVector);
         return result;
     }
 
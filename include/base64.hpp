@@ -5,11 +5,16 @@
 #ifndef BASE64_HPP
 #define BASE64_HPP
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <vector>
+#include "cpu.hpp"
 
 namespace base64
 {
@@ -20,10 +25,396 @@ namespace base64
         explicit ParseError(const char* str): std::logic_error(str) {}
     };
 
+    enum class Error
+    {
+        none,
+        invalidCharacter,
+        invalidLength,
+        outputTooSmall
+    };
+
+    struct DecodeResult final
+    {
+        std::size_t size; // number of bytes written
+        Error error;
+        std::size_t position; // offset of the offending character, or of the end of the decoded data
+    };
+
+    constexpr std::size_t encodedSize(const std::size_t size, const bool padding = true) noexcept
+    {
+        return padding ? (size + 2) / 3 * 4 : size / 3 * 4 + (size % 3 ? size % 3 + 1 : 0);
+    }
+
+    // exact for unpadded input, padding characters make it an upper bound
+    constexpr std::size_t maxDecodedSize(const std::size_t length) noexcept
+    {
+        return length / 4 * 3 + (length % 4 > 1 ? length % 4 - 1 : 0);
+    }
+
+    inline namespace detail
+    {
+        template <class T, class = void>
+        struct IsContiguous: std::false_type {};
+
+        template <class T>
+        struct IsContiguous<T, std::void_t<decltype(std::data(std::declval<const T&>())),
+                                           decltype(std::size(std::declval<const T&>()))>>: std::true_type {};
+
+        template <class Iterator>
+        constexpr bool isBytePointer = std::is_pointer_v<Iterator> &&
+            sizeof(typename std::iterator_traits<Iterator>::value_type) == 1;
+
+        // the vectorized paths only need to special-case the last two characters of the alphabet
+        template <class Chars>
+        constexpr bool hasStandardPrefix() noexcept
+        {
+            for (std::size_t i = 0; i < 62; ++i)
+                if (Chars::chars[i] != static_cast<char>(i < 26 ? 'A' + i : i < 52 ? 'a' + (i - 26) : '0' + (i - 52)))
+                    return false;
+            return true;
+        }
+
+#ifdef CPU_X86
+        // 6-bit indices to characters: A-Z, a-z and 0-9 are offset ranges, the last two come from the alphabet
+        template <class Chars>
+        CPU_TARGET("ssse3") inline __m128i translateSsse3(const __m128i indices) noexcept
+        {
+            const __m128i offsets = _mm_setr_epi8(static_cast<char>('a' - 26),
+                                                  static_cast<char>('0' - 52), static_cast<char>('0' - 52),
+                                                  static_cast<char>('0' - 52), static_cast<char>('0' - 52),
+                                                  static_cast<char>('0' - 52), static_cast<char>('0' - 52),
+                                                  static_cast<char>('0' - 52), static_cast<char>('0' - 52),
+                                                  static_cast<char>('0' - 52), static_cast<char>('0' - 52),
+                                                  static_cast<char>(Chars::chars[62] - 62),
+                                                  static_cast<char>(Chars::chars[63] - 63),
+                                                  'A', 0, 0);
+            __m128i reduced = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+            const __m128i upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+            reduced = _mm_or_si128(reduced, _mm_and_si128(upper, _mm_set1_epi8(13)));
+            return _mm_add_epi8(_mm_shuffle_epi8(offsets, reduced), indices);
+        }
+
+        // 12 bytes to 16 characters per step, reads 16 bytes
+        template <class Chars>
+        CPU_TARGET("ssse3") std::size_t encodeSsse3(const std::uint8_t* input, const std::size_t size,
+                                                    char* output) noexcept
+        {
+            std::size_t i = 0;
+            for (; size - i >= 16; i += 12, output += 16)
+            {
+                __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+                in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+                const __m128i high = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00)),
+                                                     _mm_set1_epi32(0x04000040));
+                const __m128i low = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003F03F0)),
+                                                    _mm_set1_epi32(0x01000010));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output),
+                                 translateSsse3<Chars>(_mm_or_si128(high, low)));
+            }
+            return i;
+        }
+
+        template <class Chars>
+        CPU_TARGET("avx2") inline __m256i translateAvx2(const __m256i indices) noexcept
+        {
+            const __m256i offsets = _mm256_broadcastsi128_si256(
+                _mm_setr_epi8(static_cast<char>('a' - 26),
+                              static_cast<char>('0' - 52), static_cast<char>('0' - 52),
+                              static_cast<char>('0' - 52), static_cast<char>('0' - 52),
+                              static_cast<char>('0' - 52), static_cast<char>('0' - 52),
+                              static_cast<char>('0' - 52), static_cast<char>('0' - 52),
+                              static_cast<char>('0' - 52), static_cast<char>('0' - 52),
+                              static_cast<char>(Chars::chars[62] - 62),
+                              static_cast<char>(Chars::chars[63] - 63),
+                              'A', 0, 0));
+            __m256i reduced = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+            const __m256i upper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+            reduced = _mm256_or_si256(reduced, _mm256_and_si256(upper, _mm256_set1_epi8(13)));
+            return _mm256_add_epi8(_mm256_shuffle_epi8(offsets, reduced), indices);
+        }
+
+        // 24 bytes to 32 characters per step, reads 28 bytes
+        template <class Chars>
+        CPU_TARGET("avx2") std::size_t encodeAvx2(const std::uint8_t* input, const std::size_t size,
+                                                  char* output) noexcept
+        {
+            std::size_t i = 0;
+            for (; size - i >= 28; i += 24, output += 32)
+            {
+                __m256i in = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i))),
+                                                     _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 12)), 1);
+                in = _mm256_shuffle_epi8(in, _mm256_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+                                                             10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+                const __m256i high = _mm256_mulhi_epu16(_mm256_and_si256(in, _mm256_set1_epi32(0x0FC0FC00)),
+                                                        _mm256_set1_epi32(0x04000040));
+                const __m256i low = _mm256_mullo_epi16(_mm256_and_si256(in, _mm256_set1_epi32(0x003F03F0)),
+                                                       _mm256_set1_epi32(0x01000010));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output),
+                                    translateAvx2<Chars>(_mm256_or_si256(high, low)));
+            }
+            return i + encodeSsse3<Chars>(input + i, size - i, output);
+        }
+
+        // characters to 6-bit values, the mask has a bit set for every invalid character
+        template <class Chars>
+        CPU_TARGET("ssse3") inline __m128i lookupSsse3(const __m128i in, int& invalid) noexcept
+        {
+            const __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('A' - 1)),
+                                                _mm_cmpgt_epi8(_mm_set1_epi8('Z' + 1), in));
+            const __m128i lower = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('a' - 1)),
+                                                _mm_cmpgt_epi8(_mm_set1_epi8('z' + 1), in));
+            const __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('0' - 1)),
+                                                _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), in));
+            const __m128i c62 = _mm_cmpeq_epi8(in, _mm_set1_epi8(Chars::chars[62]));
+            const __m128i c63 = _mm_cmpeq_epi8(in, _mm_set1_epi8(Chars::chars[63]));
+
+            const __m128i valid = _mm_or_si128(_mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(digit, c62)), c63);
+            invalid = _mm_movemask_epi8(valid) ^ 0xFFFF;
+
+            const __m128i shift = _mm_or_si128(_mm_or_si128(_mm_and_si128(upper, _mm_set1_epi8(-'A')),
+                                                            _mm_and_si128(lower, _mm_set1_epi8(static_cast<char>(26 - 'a')))),
+                                               _mm_or_si128(_mm_and_si128(digit, _mm_set1_epi8(52 - '0')),
+                                                            _mm_or_si128(_mm_and_si128(c62, _mm_set1_epi8(static_cast<char>(62 - Chars::chars[62]))),
+                                                                         _mm_and_si128(c63, _mm_set1_epi8(static_cast<char>(63 - Chars::chars[63]))))));
+            return _mm_add_epi8(in, shift);
+        }
+
+        // 16 characters to 12 bytes per step, writes 16 bytes; stops at the first block with a character
+        // outside of the alphabet (including padding) so that the scalar code can handle it
+        template <class Chars>
+        CPU_TARGET("ssse3") std::size_t decodeSsse3(const char* input, const std::size_t size,
+                                                    std::uint8_t* output, const std::size_t capacity) noexcept
+        {
+            std::size_t i = 0;
+            for (std::size_t o = 0; size - i >= 16 && capacity - o >= 16; i += 16, o += 12)
+            {
+                int invalid;
+                const __m128i values = lookupSsse3<Chars>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i)), invalid);
+                if (invalid) break;
+
+                const __m128i merged = _mm_madd_epi16(_mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140)),
+                                                      _mm_set1_epi32(0x00011000));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + o),
+                                 _mm_shuffle_epi8(merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1)));
+            }
+            return i;
+        }
+
+        template <class Chars>
+        CPU_TARGET("avx2") inline __m256i lookupAvx2(const __m256i in, int& invalid) noexcept
+        {
+            const __m256i upper = _mm256_and_si256(_mm256_cmpgt_epi8(in, _mm256_set1_epi8('A' - 1)),
+                                                   _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), in));
+            const __m256i lower = _mm256_and_si256(_mm256_cmpgt_epi8(in, _mm256_set1_epi8('a' - 1)),
+                                                   _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), in));
+            const __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(in, _mm256_set1_epi8('0' - 1)),
+                                                   _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), in));
+            const __m256i c62 = _mm256_cmpeq_epi8(in, _mm256_set1_epi8(Chars::chars[62]));
+            const __m256i c63 = _mm256_cmpeq_epi8(in, _mm256_set1_epi8(Chars::chars[63]));
+
+            const __m256i valid = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(upper, lower), _mm256_or_si256(digit, c62)), c63);
+            invalid = ~_mm256_movemask_epi8(valid);
+
+            const __m256i shift = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(upper, _mm256_set1_epi8(-'A')),
+                                                                  _mm256_and_si256(lower, _mm256_set1_epi8(static_cast<char>(26 - 'a')))),
+                                                  _mm256_or_si256(_mm256_and_si256(digit, _mm256_set1_epi8(52 - '0')),
+                                                                  _mm256_or_si256(_mm256_and_si256(c62, _mm256_set1_epi8(static_cast<char>(62 - Chars::chars[62]))),
+                                                                                  _mm256_and_si256(c63, _mm256_set1_epi8(static_cast<char>(63 - Chars::chars[63]))))));
+            return _mm256_add_epi8(in, shift);
+        }
+
+        // 32 characters to 24 bytes per step, writes 32 bytes
+        template <class Chars>
+        CPU_TARGET("avx2") std::size_t decodeAvx2(const char* input, const std::size_t size,
+                                                  std::uint8_t* output, const std::size_t capacity) noexcept
+        {
+            std::size_t i = 0;
+            for (std::size_t o = 0; size - i >= 32 && capacity - o >= 32; i += 32, o += 24)
+            {
+                int invalid;
+                const __m256i values = lookupAvx2<Chars>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i)), invalid);
+                if (invalid) break;
+
+                const __m256i merged = _mm256_madd_epi16(_mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140)),
+                                                         _mm256_set1_epi32(0x00011000));
+                const __m256i packed = _mm256_shuffle_epi8(merged, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                                                                    2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + o),
+                                    _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7)));
+            }
+            return i + decodeSsse3<Chars>(input + i, size - i, output + i / 4 * 3, capacity - i / 4 * 3);
+        }
+#endif
+
+        // encodes whole 3-byte groups with the widest available instruction set, returns the number of bytes consumed
+        template <class Chars>
+        std::size_t encodeBlocks(const std::uint8_t* input, const std::size_t size, char* output) noexcept
+        {
+#ifdef CPU_X86
+            if constexpr (hasStandardPrefix<Chars>())
+            {
+                static const auto encode = cpu::select<decltype(&encodeSsse3<Chars>)>({
+                    {cpu::Feature::avx2, encodeAvx2<Chars>},
+                    {cpu::Feature::ssse3, encodeSsse3<Chars>}
+                }, nullptr);
+                if (encode) return encode(input, size, output);
+            }
+#endif
+            (void)input;
+            (void)size;
+            (void)output;
+            return 0;
+        }
+
+        // decodes whole 4-character groups, returns the number of characters consumed
+        template <class Chars>
+        std::size_t decodeBlocks(const char* input, const std::size_t size,
+                                 std::uint8_t* output, const std::size_t capacity) noexcept
+        {
+#ifdef CPU_X86
+            if constexpr (hasStandardPrefix<Chars>())
+            {
+                static const auto decode = cpu::select<decltype(&decodeSsse3<Chars>)>({
+                    {cpu::Feature::avx2, decodeAvx2<Chars>},
+                    {cpu::Feature::ssse3, decodeSsse3<Chars>}
+                }, nullptr);
+                if (decode) return decode(input, size, output, capacity);
+            }
+#endif
+            (void)input;
+            (void)size;
+            (void)output;
+            (void)capacity;
+            return 0;
+        }
+
+        // maps every character to its 6-bit value, or to 0xFF if it is not part of the alphabet
+        template <class Chars>
+        constexpr std::array<std::uint8_t, 256> generateReverse() noexcept
+        {
+            std::array<std::uint8_t, 256> result{};
+            for (auto& value : result) value = 0xFF;
+            for (std::size_t i = 0; i < 64; ++i)
+                result[static_cast<std::uint8_t>(Chars::chars[i])] = static_cast<std::uint8_t>(i);
+            return result;
+        }
+
+        template <class Chars>
+        constexpr std::array<std::uint8_t, 256> reverse = generateReverse<Chars>();
+
+        template <class Chars>
+        constexpr std::uint8_t getValue(const char c) noexcept
+        {
+            return reverse<Chars>[static_cast<std::uint8_t>(c)];
+        }
+
+        // output must hold encodedSize(size, padding) characters
+        template <class Chars>
+        std::size_t encodeBuffer(const std::uint8_t* input, const std::size_t size,
+                                 char* output, const bool padding) noexcept
+        {
+            std::size_t i = encodeBlocks<Chars>(input, size, output);
+            std::size_t o = i / 3 * 4;
+
+            for (; size - i >= 3; i += 3)
+            {
+                output[o++] = Chars::chars[(input[i] & 0xFC) >> 2];
+                output[o++] = Chars::chars[((input[i] & 0x03) << 4) + ((input[i + 1] & 0xF0) >> 4)];
+                output[o++] = Chars::chars[((input[i + 1] & 0x0F) << 2) + ((input[i + 2] & 0xC0) >> 6)];
+                output[o++] = Chars::chars[input[i + 2] & 0x3F];
+            }
+
+            if (const std::size_t c = size - i)
+            {
+                output[o++] = Chars::chars[(input[i] & 0xFC) >> 2];
+
+                if (c == 1)
+                    output[o++] = Chars::chars[(input[i] & 0x03) << 4];
+                else
+                {
+                    output[o++] = Chars::chars[((input[i] & 0x03) << 4) + ((input[i + 1] & 0xF0) >> 4)];
+                    output[o++] = Chars::chars[(input[i + 1] & 0x0F) << 2];
+                }
+
+                if (padding) for (std::size_t p = c; p < 3; ++p) output[o++] = '=';
+            }
+
+            return o;
+        }
+
+        // decoding stops at the first padding character, like the throwing decode
+        template <class Chars>
+        DecodeResult decodeBuffer(const char* input, const std::size_t length,
+                                  std::uint8_t* output, const std::size_t capacity) noexcept
+        {
+            std::size_t i = decodeBlocks<Chars>(input, length, output, capacity);
+            std::size_t o = i / 4 * 3;
+
+            // whole groups without padding or invalid characters
+            for (; length - i >= 4 && capacity - o >= 3; i += 4)
+            {
+                const std::uint32_t a = getValue<Chars>(input[i]);
+                const std::uint32_t b = getValue<Chars>(input[i + 1]);
+                const std::uint32_t c = getValue<Chars>(input[i + 2]);
+                const std::uint32_t d = getValue<Chars>(input[i + 3]);
+                if ((a | b | c | d) > 63) break;
+
+                const std::uint32_t group = (a << 18) | (b << 12) | (c << 6) | d;
+                output[o++] = static_cast<std::uint8_t>(group >> 16);
+                output[o++] = static_cast<std::uint8_t>(group >> 8);
+                output[o++] = static_cast<std::uint8_t>(group);
+            }
+
+            std::uint32_t group = 0;
+            std::size_t c = 0;
+
+            for (; i != length && input[i] != '='; ++i)
+            {
+                const std::uint8_t value = getValue<Chars>(input[i]);
+                if (value > 63) return {o, Error::invalidCharacter, i};
+
+                group = (group << 6) | value;
+                if (++c == 4)
+                {
+                    if (capacity - o < 3) return {o, Error::outputTooSmall, i - 3};
+                    output[o++] = static_cast<std::uint8_t>(group >> 16);
+                    output[o++] = static_cast<std::uint8_t>(group >> 8);
+                    output[o++] = static_cast<std::uint8_t>(group);
+                    group = 0;
+                    c = 0;
+                }
+            }
+
+            if (c == 1)
+                return {o, Error::invalidLength, i - 1};
+            else if (c > 1)
+            {
+                if (capacity - o < c - 1) return {o, Error::outputTooSmall, i - c};
+                group <<= 6 * (4 - c);
+                output[o++] = static_cast<std::uint8_t>(group >> 16);
+                if (c == 3) output[o++] = static_cast<std::uint8_t>(group >> 8);
+            }
+
+            return {o, Error::none, i};
+        }
+    }
+
     template <class Chars, class Iterator>
     std::string encode(const Iterator begin, const Iterator end, const bool padding = true)
     {
         std::string result;
+
+        if constexpr (isBytePointer<Iterator>)
+        {
+            const auto size = static_cast<std::size_t>(end - begin);
+            result.resize(encodedSize(size, padding));
+            encodeBuffer<Chars>(reinterpret_cast<const std::uint8_t*>(begin), size, &result[0], padding);
+            return result;
+        }
+        else if constexpr (std::is_base_of_v<std::random_access_iterator_tag,
+                                             typename std::iterator_traits<Iterator>::iterator_category>)
+            result.reserve(encodedSize(static_cast<std::size_t>(end - begin), padding));
+
         std::size_t c = 0;
         std::array<std::uint8_t, 3> charArray;
 
@@ -58,6 +449,201 @@ namespace base64
         return result;
     }
 
+    template <class Chars, class Exception = ParseError, class Iterator>
+    std::vector<std::uint8_t> decode(const Iterator begin, const Iterator end)
+    {
+        if constexpr (isBytePointer<Iterator>)
+        {
+            const auto length = static_cast<std::size_t>(end - begin);
+            std::vector<std::uint8_t> result(maxDecodedSize(length));
+            const auto r = decodeBuffer<Chars>(reinterpret_cast<const char*>(begin), length,
+                                               result.data(), result.size());
+            if (r.error == Error::invalidCharacter)
+                throw Exception("Invalid Base64 digit");
+            else if (r.error != Error::none)
+                throw Exception("Invalid Base64");
+
+            result.resize(r.size);
+            return result;
+        }
+
+        std::vector<std::uint8_t> result;
+        if constexpr (std::is_base_of_v<std::random_access_iterator_tag,
+                                        typename std::iterator_traits<Iterator>::iterator_category>)
+            result.reserve(maxDecodedSize(static_cast<std::size_t>(end - begin)));
+
+        std::uint32_t group = 0;
+        std::size_t c = 0;
+
+        for (auto i = begin; i != end && *i != '='; ++i)
+        {
+            const std::uint8_t value = getValue<Chars>(static_cast<char>(*i));
+            if (value > 63) throw Exception("Invalid Base64 digit");
+
+            group = (group << 6) | value;
+            if (++c == 4)
+            {
+                result.push_back(static_cast<std::uint8_t>(group >> 16));
+                result.push_back(static_cast<std::uint8_t>(group >> 8));
+                result.push_back(static_cast<std::uint8_t>(group));
+                group = 0;
+                c = 0;
+            }
+        }
+
+        if (c == 1)
+            throw Exception("Invalid Base64");
+        else if (c > 1)
+        {
+            group <<= 6 * (4 - c);
+            result.push_back(static_cast<std::uint8_t>(group >> 16));
+            if (c == 3) result.push_back(static_cast<std::uint8_t>(group >> 8));
+        }
+
+        return result;
+    }
+
+    struct StreamResult final
+    {
+        std::size_t consumed; // input elements consumed, on error the offending character
+        std::size_t written; // output elements written
+        Error error;
+    };
+
+    // incremental encoder, buffers up to two bytes between update calls
+    template <class Chars>
+    class BasicEncoder final
+    {
+    public:
+        explicit BasicEncoder(const bool p = true) noexcept: padding(p) {}
+
+        // stops early when the output is full, the unconsumed input has to be passed again
+        template <class T, std::enable_if_t<sizeof(T) == 1>* = nullptr>
+        StreamResult update(const T* input, const std::size_t size,
+                            char* output, const std::size_t capacity) noexcept
+        {
+            const auto bytes = reinterpret_cast<const std::uint8_t*>(input);
+            std::size_t i = 0;
+            std::size_t o = 0;
+
+            if (pendingSize)
+            {
+                if (pendingSize + size < 3)
+                {
+                    while (i != size) pending[pendingSize++] = bytes[i++];
+                    return {i, o, Error::none};
+                }
+                if (capacity < 4) return {0, 0, Error::outputTooSmall};
+
+                while (pendingSize < 3) pending[pendingSize++] = bytes[i++];
+                o = encodeBuffer<Chars>(pending.data(), 3, output, false);
+                pendingSize = 0;
+            }
+
+            const std::size_t groups = std::min((size - i) / 3, (capacity - o) / 4);
+            o += encodeBuffer<Chars>(bytes + i, groups * 3, output + o, false);
+            i += groups * 3;
+
+            if (size - i < 3)
+                while (i != size) pending[pendingSize++] = bytes[i++];
+
+            return {i, o, i == size ? Error::none : Error::outputTooSmall};
+        }
+
+        // writes at most four characters and resets the encoder
+        StreamResult finalize(char* output, const std::size_t capacity) noexcept
+        {
+            const std::size_t size = encodedSize(pendingSize, padding);
+            if (capacity < size) return {0, 0, Error::outputTooSmall};
+
+            encodeBuffer<Chars>(pending.data(), pendingSize, output, padding);
+            pendingSize = 0;
+            return {0, size, Error::none};
+        }
+
+    private:
+        bool padding;
+        std::array<std::uint8_t, 3> pending;
+        std::size_t pendingSize = 0;
+    };
+
+    // incremental decoder, buffers up to three characters between update calls and ignores everything after padding
+    template <class Chars>
+    class BasicDecoder final
+    {
+    public:
+        explicit BasicDecoder(const bool s = false) noexcept: skipWhitespace(s) {}
+
+        StreamResult update(const char* input, const std::size_t length,
+                            std::uint8_t* output, const std::size_t capacity) noexcept
+        {
+            std::size_t i = 0;
+            std::size_t o = 0;
+
+            while (i != length && !finished)
+            {
+                if (!pendingSize)
+                {
+                    const std::size_t consumed = decodeBlocks<Chars>(input + i, length - i, output + o, capacity - o);
+                    i += consumed;
+                    o += consumed / 4 * 3;
+                    if (i == length) break;
+                }
+
+                const char c = input[i];
+                const std::uint8_t value = getValue<Chars>(c);
+
+                if (value > 63)
+                {
+                    if (c == '=')
+                        finished = true;
+                    else if (!skipWhitespace || (c != ' ' && c != '\t' && c != '\r' && c != '\n'))
+                        return {i, o, Error::invalidCharacter};
+
+                    ++i;
+                    continue;
+                }
+
+                if (pendingSize == 3 && capacity - o < 3) return {i, o, Error::outputTooSmall};
+
+                pending[pendingSize++] = value;
+                ++i;
+
+                if (pendingSize == 4)
+                {
+                    output[o++] = static_cast<std::uint8_t>((pending[0] << 2) + ((pending[1] & 0x30) >> 4));
+                    output[o++] = static_cast<std::uint8_t>(((pending[1] & 0x0F) << 4) + ((pending[2] & 0x3C) >> 2));
+                    output[o++] = static_cast<std::uint8_t>(((pending[2] & 0x03) << 6) + pending[3]);
+                    pendingSize = 0;
+                }
+            }
+
+            return {length, o, Error::none};
+        }
+
+        // writes at most two bytes and resets the decoder
+        StreamResult finalize(std::uint8_t* output, const std::size_t capacity) noexcept
+        {
+            if (pendingSize == 1) return {0, 0, Error::invalidLength};
+
+            const std::size_t size = pendingSize ? pendingSize - 1 : 0;
+            if (capacity < size) return {0, 0, Error::outputTooSmall};
+
+            if (size >= 1) output[0] = static_cast<std::uint8_t>((pending[0] << 2) + ((pending[1] & 0x30) >> 4));
+            if (size == 2) output[1] = static_cast<std::uint8_t>(((pending[1] & 0x0F) << 4) + ((pending[2] & 0x3C) >> 2));
+
+            pendingSize = 0;
+            finished = false;
+            return {0, size, Error::none};
+        }
+
+    private:
+        bool skipWhitespace;
+        bool finished = false;
+        std::array<std::uint8_t, 4> pending;
+        std::size_t pendingSize = 0;
+    };
+
     inline namespace detail
     {
         struct Chars final
@@ -72,6 +658,9 @@ namespace base64
         };
     }
 
+    using Encoder = BasicEncoder<Chars>;
+    using Decoder = BasicDecoder<Chars>;
+
     template <class Iterator>
     std::string encode(const Iterator begin, const Iterator end, const bool padding = true)
     {
@@ -81,55 +670,25 @@ namespace base64
     template <class T>
     std::string encode(const T& v, const bool padding = true)
     {
-        return encode(std::begin(v), std::end(v), padding);
+        if constexpr (IsContiguous<T>::value)
+            return encode(std::data(v), std::data(v) + std::size(v), padding);
+        else
+            return encode(std::begin(v), std::end(v), padding);
     }
 
     template <class Iterator>
     std::vector<std::uint8_t> decode(const Iterator begin, const Iterator end)
     {
-        std::uint32_t c = 0;
-        std::array<std::uint8_t, 4> charArray;
-        std::vector<std::uint8_t> result;
-
-        for (auto i = begin; i != end && *i != '='; ++i)
-        {
-            const auto b = static_cast<std::uint8_t>(*i);
-
-            charArray[c++] = (b >= 'A' && b <= 'Z') ? b - 'A' :
-                (b >= 'a' && b <= 'z') ? 26 + (b - 'a') :
-                (b >= '0' && b <= '9') ? 52 + (b - '0') :
-                (b == '+') ? 62 : (b == '/') ? 63 :
-                throw ParseError("Invalid Base64 digit");
-
-            if (c == 4)
-            {
-                result.push_back(static_cast<std::uint8_t>((charArray[0] << 2) + ((charArray[1] & 0x30) >> 4)));
-                result.push_back(static_cast<std::uint8_t>(((charArray[1] & 0x0F) << 4) + ((charArray[2] & 0x3C) >> 2)));
-                result.push_back(static_cast<std::uint8_t>(((charArray[2] & 0x3) << 6) + charArray[3]));
-                c = 0;
-            }
-        }
-
-        if (c)
-        {
-            if (c == 1)
-                throw ParseError("Invalid Base64");
-            else if (c == 2)
-                result.push_back(static_cast<std::uint8_t>((charArray[0] << 2) + ((charArray[1] & 0x30) >> 4)));
-            else if (c == 3)
-            {
-                result.push_back(static_cast<std::uint8_t>((charArray[0] << 2) + ((charArray[1] & 0x30) >> 4)));
-                result.push_back(static_cast<std::uint8_t>(((charArray[1] & 0x0F) << 4) + ((charArray[2] & 0x3C) >> 2)));
-            }
-        }
-
-        return result;
+        return decode<Chars>(begin, end);
     }
 
     template <class T>
     std::vector<std::uint8_t> decode(const T& s)
     {
-        return decode(std::begin(s), std::end(s));
+        if constexpr (IsContiguous<T>::value)
+            return decode(std::data(s), std::data(s) + std::size(s));
+        else
+            return decode(std::begin(s), std::end(s));
     }
 
     inline std::vector<std::uint8_t> decode(const char* s)
@@ -138,6 +697,20 @@ namespace base64
         while (*end) ++end;
         return decode(s, end);
     }
+
+    // writes encodedSize(size, padding) characters, returns the number written
+    template <class T, std::enable_if_t<sizeof(T) == 1>* = nullptr>
+    std::size_t encode(const T* input, const std::size_t size, char* output, const bool padding = true) noexcept
+    {
+        return encodeBuffer<Chars>(reinterpret_cast<const std::uint8_t*>(input), size, output, padding);
+    }
+
+    // writes at most capacity bytes, reports invalid input through the result instead of throwing
+    inline DecodeResult decode(const char* input, const std::size_t length,
+                               std::uint8_t* output, const std::size_t capacity) noexcept
+    {
+        return decodeBuffer<Chars>(input, length, output, capacity);
+    }
 }
 
 namespace base64url
@@ -149,6 +722,12 @@ namespace base64url
         explicit ParseError(const char* str): std::logic_error(str) {}
     };
 
+    using base64::Error;
+    using base64::DecodeResult;
+    using base64::StreamResult;
+    using base64::encodedSize;
+    using base64::maxDecodedSize;
+
     inline namespace detail
     {
         struct Chars final
@@ -163,6 +742,9 @@ namespace base64url
         };
     }
 
+    using Encoder = base64::BasicEncoder<Chars>;
+    using Decoder = base64::BasicDecoder<Chars>;
+
     template <class Iterator>
     std::string encode(const Iterator begin, const Iterator end, const bool padding = true)
     {
@@ -172,55 +754,25 @@ namespace base64url
     template <class T>
     std::string encode(const T& v, const bool padding = true)
     {
-        return encode(std::begin(v), std::end(v), padding);
+        if constexpr (base64::IsContiguous<T>::value)
+            return encode(std::data(v), std::data(v) + std::size(v), padding);
+        else
+            return encode(std::begin(v), std::end(v), padding);
     }
 
     template <class Iterator>
     std::vector<std::uint8_t> decode(const Iterator begin, const Iterator end)
     {
-        std::uint32_t c = 0;
-        std::array<std::uint8_t, 4> charArray;
-        std::vector<std::uint8_t> result;
-
-        for (auto i = begin; i != end && *i != '='; ++i)
-        {
-            const auto b = static_cast<std::uint8_t>(*i);
-
-            charArray[c++] = (b >= 'A' && b <= 'Z') ? b - 'A' :
-                (b >= 'a' && b <= 'z') ? 26 + (b - 'a') :
-                (b >= '0' && b <= '9') ? 52 + (b - '0') :
-                (b == '-') ? 62 : (b == '_') ? 63 :
-                throw ParseError("Invalid Base64 digit");
-
-            if (c == 4)
-            {
-                result.push_back(static_cast<std::uint8_t>((charArray[0] << 2) + ((charArray[1] & 0x30) >> 4)));
-                result.push_back(static_cast<std::uint8_t>(((charArray[1] & 0x0F) << 4) + ((charArray[2] & 0x3C) >> 2)));
-                result.push_back(static_cast<std::uint8_t>(((charArray[2] & 0x3) << 6) + charArray[3]));
-                c = 0;
-            }
-        }
-
-        if (c)
-        {
-            if (c == 1)
-                throw ParseError("Invalid Base64");
-            else if (c == 2)
-                result.push_back(static_cast<std::uint8_t>((charArray[0] << 2) + ((charArray[1] & 0x30) >> 4)));
-            else if (c == 3)
-            {
-                result.push_back(static_cast<std::uint8_t>((charArray[0] << 2) + ((charArray[1] & 0x30) >> 4)));
-                result.push_back(static_cast<std::uint8_t>(((charArray[1] & 0x0F) << 4) + ((charArray[2] & 0x3C) >> 2)));
-            }
-        }
-
-        return result;
+        return base64::decode<Chars, ParseError>(begin, end);
     }
 
     template <class T>
     std::vector<std::uint8_t> decode(const T& s)
     {
-        return decode(std::begin(s), std::end(s));
+        if constexpr (base64::IsContiguous<T>::value)
+            return decode(std::data(s), std::data(s) + std::size(s));
+        else
+            return decode(std::begin(s), std::end(s));
     }
 
     inline std::vector<std::uint8_t> decode(const char* s)
@@ -229,6 +781,20 @@ namespace base64url
         while (*end) ++end;
         return decode(s, end);
     }
+
+    // writes encodedSize(size, padding) characters, returns the number written
+    template <class T, std::enable_if_t<sizeof(T) == 1>* = nullptr>
+    std::size_t encode(const T* input, const std::size_t size, char* output, const bool padding = true) noexcept
+    {
+        return base64::encodeBuffer<Chars>(reinterpret_cast<const std::uint8_t*>(input), size, output, padding);
+    }
+
+    // writes at most capacity bytes, reports invalid input through the result instead of throwing
+    inline DecodeResult decode(const char* input, const std::size_t length,
+                               std::uint8_t* output, const std::size_t capacity) noexcept
+    {
+        return base64::decodeBuffer<Chars>(input, length, output, capacity);
+    }
 }
 
 #endif // BASE64_HPP
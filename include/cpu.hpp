@@ -0,0 +1,272 @@
+//
+// Header-only libs
+//
+
+#ifndef CPU_HPP
+#define CPU_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <initializer_list>
+#include <string_view>
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#  include <immintrin.h>
+#  if defined(_MSC_VER) && !defined(__clang__)
+#    include <intrin.h>
+#  else
+#    include <cpuid.h>
+#  endif
+#  define CPU_X86
+// lets a function use instructions beyond the compiler flags, it must only run after a feature check
+#  if defined(__GNUC__) || defined(__clang__)
+#    define CPU_TARGET(x) __attribute__((target(x)))
+#  else
+#    define CPU_TARGET(x)
+#  endif
+#endif
+
+namespace cpu
+{
+    enum class Feature: std::uint32_t
+    {
+        none = 0,
+        sse2 = 1U << 0,
+        ssse3 = 1U << 1,
+        sse41 = 1U << 2,
+        sse42 = 1U << 3,
+        avx = 1U << 4,
+        avx2 = 1U << 5,
+        avx512f = 1U << 6,
+        avx512bw = 1U << 7,
+        avx512vl = 1U << 8,
+        aes = 1U << 9,
+        pclmul = 1U << 10,
+        sha = 1U << 11
+    };
+
+    constexpr Feature operator|(const Feature lhs, const Feature rhs) noexcept
+    {
+        return static_cast<Feature>(static_cast<std::uint32_t>(lhs) | static_cast<std::uint32_t>(rhs));
+    }
+
+    constexpr Feature operator&(const Feature lhs, const Feature rhs) noexcept
+    {
+        return static_cast<Feature>(static_cast<std::uint32_t>(lhs) & static_cast<std::uint32_t>(rhs));
+    }
+
+    constexpr Feature operator~(const Feature feature) noexcept
+    {
+        return static_cast<Feature>(~static_cast<std::uint32_t>(feature));
+    }
+
+    // vector instruction set levels, each includes the ones before it
+    enum class Tier
+    {
+        scalar,
+        sse2,
+        ssse3,
+        sse41,
+        sse42,
+        avx2,
+        avx512
+    };
+
+    inline namespace detail
+    {
+        struct FeatureName final
+        {
+            std::string_view name;
+            Feature feature;
+        };
+
+        constexpr FeatureName featureNames[] = {
+            {"sse2", Feature::sse2},
+            {"ssse3", Feature::ssse3},
+            {"sse41", Feature::sse41},
+            {"sse42", Feature::sse42},
+            {"avx", Feature::avx},
+            {"avx2", Feature::avx2},
+            {"avx512f", Feature::avx512f},
+            {"avx512bw", Feature::avx512bw},
+            {"avx512vl", Feature::avx512vl},
+            {"aes", Feature::aes},
+            {"pclmul", Feature::pclmul},
+            {"sha", Feature::sha}
+        };
+
+        constexpr std::array<std::string_view, 7> tierNames = {
+            "scalar", "sse2", "ssse3", "sse41", "sse42", "avx2", "avx512"
+        };
+
+        // the vector features a tier adds to the previous one
+        constexpr std::array<Feature, 7> tierFeatures = {
+            Feature::none,
+            Feature::sse2,
+            Feature::ssse3,
+            Feature::sse41,
+            Feature::sse42,
+            Feature::avx | Feature::avx2,
+            Feature::avx512f | Feature::avx512bw | Feature::avx512vl
+        };
+
+        // AES-NI, PCLMULQDQ and SHA work on SSE registers, so every tier but the scalar one keeps them
+        constexpr Feature extensionFeatures = Feature::aes | Feature::pclmul | Feature::sha;
+
+        constexpr Feature getTierMask(const Tier tier) noexcept
+        {
+            Feature result = tier == Tier::scalar ? Feature::none : extensionFeatures;
+            for (std::size_t i = 0; i <= static_cast<std::size_t>(tier); ++i)
+                result = result | tierFeatures[i];
+            return result;
+        }
+
+#ifdef CPU_X86
+        inline void cpuid(const std::uint32_t leaf, const std::uint32_t subleaf, std::uint32_t (&registers)[4]) noexcept
+        {
+#  if defined(_MSC_VER) && !defined(__clang__)
+            int info[4];
+            __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subleaf));
+            for (std::size_t i = 0; i < 4; ++i)
+                registers[i] = static_cast<std::uint32_t>(info[i]);
+#  else
+            __cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+#  endif
+        }
+
+        // the register states that the operating system preserves across context switches
+        inline std::uint64_t getEnabledStates() noexcept
+        {
+#  if defined(_MSC_VER) && !defined(__clang__)
+            return _xgetbv(0);
+#  else
+            std::uint32_t low;
+            std::uint32_t high;
+            __asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+            return (static_cast<std::uint64_t>(high) << 32) | low;
+#  endif
+        }
+#endif
+
+        inline Feature detect() noexcept
+        {
+            Feature result = Feature::none;
+#ifdef CPU_X86
+            const auto add = [&result](const std::uint32_t reg, const int bit, const Feature feature) noexcept {
+                if (reg & (1U << bit)) result = result | feature;
+            };
+
+            std::uint32_t registers[4];
+            cpuid(0, 0, registers);
+            const std::uint32_t maxLeaf = registers[0];
+            if (maxLeaf < 1) return result;
+
+            cpuid(1, 0, registers);
+            const std::uint32_t ecx = registers[2];
+            const std::uint32_t edx = registers[3];
+            add(edx, 26, Feature::sse2);
+            add(ecx, 9, Feature::ssse3);
+            add(ecx, 19, Feature::sse41);
+            add(ecx, 20, Feature::sse42);
+            add(ecx, 25, Feature::aes);
+            add(ecx, 1, Feature::pclmul);
+
+            // AVX needs the operating system to save the YMM registers, AVX-512 also the opmask and ZMM registers
+            const std::uint64_t states = (ecx & (1U << 27)) ? getEnabledStates() : 0;
+            const bool ymm = (states & 0x06) == 0x06;
+            const bool zmm = (states & 0xE6) == 0xE6;
+            if (ymm) add(ecx, 28, Feature::avx);
+
+            if (maxLeaf >= 7)
+            {
+                cpuid(7, 0, registers);
+                const std::uint32_t ebx = registers[1];
+                if (ymm) add(ebx, 5, Feature::avx2);
+                if (zmm)
+                {
+                    add(ebx, 16, Feature::avx512f);
+                    add(ebx, 30, Feature::avx512bw);
+                    add(ebx, 31, Feature::avx512vl);
+                }
+                add(ebx, 29, Feature::sha);
+            }
+#endif
+            return result;
+        }
+
+        // applies a setting like "ssse3", "avx2,-pclmul" or "-aes": an optional tier that caps the vector
+        // features, followed by features to turn off, unknown names are ignored
+        inline Feature applySetting(Feature features, const std::string_view setting) noexcept
+        {
+            for (std::size_t begin = 0; begin <= setting.size();)
+            {
+                auto end = setting.find(',', begin);
+                if (end == std::string_view::npos) end = setting.size();
+                const auto item = setting.substr(begin, end - begin);
+                begin = end + 1;
+
+                if (!item.empty() && item[0] == '-')
+                {
+                    for (const auto& featureName : featureNames)
+                        if (item.substr(1) == featureName.name)
+                            features = features & ~featureName.feature;
+                }
+                else
+                    for (std::size_t tier = 0; tier < tierNames.size(); ++tier)
+                        if (item == tierNames[tier])
+                            features = features & getTierMask(static_cast<Tier>(tier));
+            }
+            return features;
+        }
+    }
+
+    // the features of this CPU, detected once on first use (thread-safe) and limited by the HLIBS_CPU
+    // environment variable, which forces slower paths for testing and comparison
+    inline Feature getFeatures() noexcept
+    {
+        static const Feature features = [] {
+            const char* setting = std::getenv("HLIBS_CPU");
+            return setting ? applySetting(detect(), setting) : detect();
+        }();
+        return features;
+    }
+
+    inline bool hasFeatures(const Feature required) noexcept
+    {
+        return (getFeatures() & required) == required;
+    }
+
+    // the highest tier with all of its vector features available
+    inline Tier getTier() noexcept
+    {
+        std::size_t tier = 0;
+        while (tier + 1 < tierFeatures.size() && hasFeatures(tierFeatures[tier + 1])) ++tier;
+        return static_cast<Tier>(tier);
+    }
+
+    constexpr std::string_view getName(const Tier tier) noexcept
+    {
+        return tierNames[static_cast<std::size_t>(tier)];
+    }
+
+    template <class Function>
+    struct Implementation final
+    {
+        Feature required;
+        Function function;
+    };
+
+    // the first implementation whose features are available, or the fallback, to be stored in a
+    // function-local static so that every later call costs a single indirect call
+    template <class Function>
+    Function select(const std::initializer_list<Implementation<Function>> implementations,
+                    const Function fallback) noexcept
+    {
+        for (const auto& implementation : implementations)
+            if (hasFeatures(implementation.required)) return implementation.function;
+        return fallback;
+    }
+}
+
+#endif // CPU_HPP
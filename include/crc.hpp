@@ -6,168 +6,377 @@
 #define CRC_HPP
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include "cpu.hpp"
 
 namespace crc
 {
     inline namespace detail
     {
-        template <typename T> constexpr T getEntry(std::uint8_t i) noexcept;
-        template <typename T> constexpr T getInit() noexcept;
-        template <typename T> constexpr T getXorOut() noexcept;
-
-        constexpr std::array<std::uint8_t, 256> table8 = {
-            0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31,
-            0x24, 0x23, 0x2A, 0x2D, 0x70, 0x77, 0x7E, 0x79, 0x6C, 0x6B, 0x62, 0x65,
-            0x48, 0x4F, 0x46, 0x41, 0x54, 0x53, 0x5A, 0x5D, 0xE0, 0xE7, 0xEE, 0xE9,
-            0xFC, 0xFB, 0xF2, 0xF5, 0xD8, 0xDF, 0xD6, 0xD1, 0xC4, 0xC3, 0xCA, 0xCD,
-            0x90, 0x97, 0x9E, 0x99, 0x8C, 0x8B, 0x82, 0x85, 0xA8, 0xAF, 0xA6, 0xA1,
-            0xB4, 0xB3, 0xBA, 0xBD, 0xC7, 0xC0, 0xC9, 0xCE, 0xDB, 0xDC, 0xD5, 0xD2,
-            0xFF, 0xF8, 0xF1, 0xF6, 0xE3, 0xE4, 0xED, 0xEA, 0xB7, 0xB0, 0xB9, 0xBE,
-            0xAB, 0xAC, 0xA5, 0xA2, 0x8F, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9D, 0x9A,
-            0x27, 0x20, 0x29, 0x2E, 0x3B, 0x3C, 0x35, 0x32, 0x1F, 0x18, 0x11, 0x16,
-            0x03, 0x04, 0x0D, 0x0A, 0x57, 0x50, 0x59, 0x5E, 0x4B, 0x4C, 0x45, 0x42,
-            0x6F, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7D, 0x7A, 0x89, 0x8E, 0x87, 0x80,
-            0x95, 0x92, 0x9B, 0x9C, 0xB1, 0xB6, 0xBF, 0xB8, 0xAD, 0xAA, 0xA3, 0xA4,
-            0xF9, 0xFE, 0xF7, 0xF0, 0xE5, 0xE2, 0xEB, 0xEC, 0xC1, 0xC6, 0xCF, 0xC8,
-            0xDD, 0xDA, 0xD3, 0xD4, 0x69, 0x6E, 0x67, 0x60, 0x75, 0x72, 0x7B, 0x7C,
-            0x51, 0x56, 0x5F, 0x58, 0x4D, 0x4A, 0x43, 0x44, 0x19, 0x1E, 0x17, 0x10,
-            0x05, 0x02, 0x0B, 0x0C, 0x21, 0x26, 0x2F, 0x28, 0x3D, 0x3A, 0x33, 0x34,
-            0x4E, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5C, 0x5B, 0x76, 0x71, 0x78, 0x7F,
-            0x6A, 0x6D, 0x64, 0x63, 0x3E, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2C, 0x2B,
-            0x06, 0x01, 0x08, 0x0F, 0x1A, 0x1D, 0x14, 0x13, 0xAE, 0xA9, 0xA0, 0xA7,
-            0xB2, 0xB5, 0xBC, 0xBB, 0x96, 0x91, 0x98, 0x9F, 0x8A, 0x8D, 0x84, 0x83,
-            0xDE, 0xD9, 0xD0, 0xD7, 0xC2, 0xC5, 0xCC, 0xCB, 0xE6, 0xE1, 0xE8, 0xEF,
-            0xFA, 0xFD, 0xF4, 0xF3
-        };
-
-        template <> constexpr std::uint8_t getEntry<std::uint8_t>(std::uint8_t i) noexcept
-        {
-            return table8[i];
-        }
-
-        template <> constexpr std::uint8_t getInit() noexcept
-        {
-            return 0x00;
-        }
-
-        template <> constexpr std::uint8_t getXorOut() noexcept
-        {
-            return 0x00;
-        }
-
-        constexpr std::array<std::uint16_t, 256> table16 = {
-            0x0000, 0x1189, 0x2312, 0x329B, 0x4624, 0x57AD, 0x6536, 0x74BF,
-            0x8C48, 0x9DC1, 0xAF5A, 0xBED3, 0xCA6C, 0xDBE5, 0xE97E, 0xF8F7,
-            0x1081, 0x0108, 0x3393, 0x221A, 0x56A5, 0x472C, 0x75B7, 0x643E,
-            0x9CC9, 0x8D40, 0xBFDB, 0xAE52, 0xDAED, 0xCB64, 0xF9FF, 0xE876,
-            0x2102, 0x308B, 0x0210, 0x1399, 0x6726, 0x76AF, 0x4434, 0x55BD,
-            0xAD4A, 0xBCC3, 0x8E58, 0x9FD1, 0xEB6E, 0xFAE7, 0xC87C, 0xD9F5,
-            0x3183, 0x200A, 0x1291, 0x0318, 0x77A7, 0x662E, 0x54B5, 0x453C,
-            0xBDCB, 0xAC42, 0x9ED9, 0x8F50, 0xFBEF, 0xEA66, 0xD8FD, 0xC974,
-            0x4204, 0x538D, 0x6116, 0x709F, 0x0420, 0x15A9, 0x2732, 0x36BB,
-            0xCE4C, 0xDFC5, 0xED5E, 0xFCD7, 0x8868, 0x99E1, 0xAB7A, 0xBAF3,
-            0x5285, 0x430C, 0x7197, 0x601E, 0x14A1, 0x0528, 0x37B3, 0x263A,
-            0xDECD, 0xCF44, 0xFDDF, 0xEC56, 0x98E9, 0x8960, 0xBBFB, 0xAA72,
-            0x6306, 0x728F, 0x4014, 0x519D, 0x2522, 0x34AB, 0x0630, 0x17B9,
-            0xEF4E, 0xFEC7, 0xCC5C, 0xDDD5, 0xA96A, 0xB8E3, 0x8A78, 0x9BF1,
-            0x7387, 0x620E, 0x5095, 0x411C, 0x35A3, 0x242A, 0x16B1, 0x0738,
-            0xFFCF, 0xEE46, 0xDCDD, 0xCD54, 0xB9EB, 0xA862, 0x9AF9, 0x8B70,
-            0x8408, 0x9581, 0xA71A, 0xB693, 0xC22C, 0xD3A5, 0xE13E, 0xF0B7,
-            0x0840, 0x19C9, 0x2B52, 0x3ADB, 0x4E64, 0x5FED, 0x6D76, 0x7CFF,
-            0x9489, 0x8500, 0xB79B, 0xA612, 0xD2AD, 0xC324, 0xF1BF, 0xE036,
-            0x18C1, 0x0948, 0x3BD3, 0x2A5A, 0x5EE5, 0x4F6C, 0x7DF7, 0x6C7E,
-            0xA50A, 0xB483, 0x8618, 0x9791, 0xE32E, 0xF2A7, 0xC03C, 0xD1B5,
-            0x2942, 0x38CB, 0x0A50, 0x1BD9, 0x6F66, 0x7EEF, 0x4C74, 0x5DFD,
-            0xB58B, 0xA402, 0x9699, 0x8710, 0xF3AF, 0xE226, 0xD0BD, 0xC134,
-            0x39C3, 0x284A, 0x1AD1, 0x0B58, 0x7FE7, 0x6E6E, 0x5CF5, 0x4D7C,
-            0xC60C, 0xD785, 0xE51E, 0xF497, 0x8028, 0x91A1, 0xA33A, 0xB2B3,
-            0x4A44, 0x5BCD, 0x6956, 0x78DF, 0x0C60, 0x1DE9, 0x2F72, 0x3EFB,
-            0xD68D, 0xC704, 0xF59F, 0xE416, 0x90A9, 0x8120, 0xB3BB, 0xA232,
-            0x5AC5, 0x4B4C, 0x79D7, 0x685E, 0x1CE1, 0x0D68, 0x3FF3, 0x2E7A,
-            0xE70E, 0xF687, 0xC41C, 0xD595, 0xA12A, 0xB0A3, 0x8238, 0x93B1,
-            0x6B46, 0x7ACF, 0x4854, 0x59DD, 0x2D62, 0x3CEB, 0x0E70, 0x1FF9,
-            0xF78F, 0xE606, 0xD49D, 0xC514, 0xB1AB, 0xA022, 0x92B9, 0x8330,
-            0x7BC7, 0x6A4E, 0x58D5, 0x495C, 0x3DE3, 0x2C6A, 0x1EF1, 0x0F78
-        };
-
-        template <> constexpr std::uint16_t getEntry<std::uint16_t>(std::uint8_t i) noexcept
-        {
-            return table16[i];
-        }
-
-        template <> constexpr std::uint16_t getInit() noexcept
-        {
-            return 0x0000;
-        }
-
-        template <> constexpr std::uint16_t getXorOut() noexcept
-        {
-            return 0x0000;
-        }
-
-        constexpr std::array<std::uint32_t, 256> table32 = {
-            0x00000000U, 0x77073096U, 0xEE0E612CU, 0x990951BAU, 0x076DC419U, 0x706AF48FU, 0xE963A535U, 0x9E6495A3U,
-            0x0EDB8832U, 0x79DCB8A4U, 0xE0D5E91EU, 0x97D2D988U, 0x09B64C2BU, 0x7EB17CBDU, 0xE7B82D07U, 0x90BF1D91U,
-            0x1DB71064U, 0x6AB020F2U, 0xF3B97148U, 0x84BE41DEU, 0x1ADAD47DU, 0x6DDDE4EBU, 0xF4D4B551U, 0x83D385C7U,
-            0x136C9856U, 0x646BA8C0U, 0xFD62F97AU, 0x8A65C9ECU, 0x14015C4FU, 0x63066CD9U, 0xFA0F3D63U, 0x8D080DF5U,
-            0x3B6E20C8U, 0x4C69105EU, 0xD56041E4U, 0xA2677172U, 0x3C03E4D1U, 0x4B04D447U, 0xD20D85FDU, 0xA50AB56BU,
-            0x35B5A8FAU, 0x42B2986CU, 0xDBBBC9D6U, 0xACBCF940U, 0x32D86CE3U, 0x45DF5C75U, 0xDCD60DCFU, 0xABD13D59U,
-            0x26D930ACU, 0x51DE003AU, 0xC8D75180U, 0xBFD06116U, 0x21B4F4B5U, 0x56B3C423U, 0xCFBA9599U, 0xB8BDA50FU,
-            0x2802B89EU, 0x5F058808U, 0xC60CD9B2U, 0xB10BE924U, 0x2F6F7C87U, 0x58684C11U, 0xC1611DABU, 0xB6662D3DU,
-            0x76DC4190U, 0x01DB7106U, 0x98D220BCU, 0xEFD5102AU, 0x71B18589U, 0x06B6B51FU, 0x9FBFE4A5U, 0xE8B8D433U,
-            0x7807C9A2U, 0x0F00F934U, 0x9609A88EU, 0xE10E9818U, 0x7F6A0DBBU, 0x086D3D2DU, 0x91646C97U, 0xE6635C01U,
-            0x6B6B51F4U, 0x1C6C6162U, 0x856530D8U, 0xF262004EU, 0x6C0695EDU, 0x1B01A57BU, 0x8208F4C1U, 0xF50FC457U,
-            0x65B0D9C6U, 0x12B7E950U, 0x8BBEB8EAU, 0xFCB9887CU, 0x62DD1DDFU, 0x15DA2D49U, 0x8CD37CF3U, 0xFBD44C65U,
-            0x4DB26158U, 0x3AB551CEU, 0xA3BC0074U, 0xD4BB30E2U, 0x4ADFA541U, 0x3DD895D7U, 0xA4D1C46DU, 0xD3D6F4FBU,
-            0x4369E96AU, 0x346ED9FCU, 0xAD678846U, 0xDA60B8D0U, 0x44042D73U, 0x33031DE5U, 0xAA0A4C5FU, 0xDD0D7CC9U,
-            0x5005713CU, 0x270241AAU, 0xBE0B1010U, 0xC90C2086U, 0x5768B525U, 0x206F85B3U, 0xB966D409U, 0xCE61E49FU,
-            0x5EDEF90EU, 0x29D9C998U, 0xB0D09822U, 0xC7D7A8B4U, 0x59B33D17U, 0x2EB40D81U, 0xB7BD5C3BU, 0xC0BA6CADU,
-            0xEDB88320U, 0x9ABFB3B6U, 0x03B6E20CU, 0x74B1D29AU, 0xEAD54739U, 0x9DD277AFU, 0x04DB2615U, 0x73DC1683U,
-            0xE3630B12U, 0x94643B84U, 0x0D6D6A3EU, 0x7A6A5AA8U, 0xE40ECF0BU, 0x9309FF9DU, 0x0A00AE27U, 0x7D079EB1U,
-            0xF00F9344U, 0x8708A3D2U, 0x1E01F268U, 0x6906C2FEU, 0xF762575DU, 0x806567CBU, 0x196C3671U, 0x6E6B06E7U,
-            0xFED41B76U, 0x89D32BE0U, 0x10DA7A5AU, 0x67DD4ACCU, 0xF9B9DF6FU, 0x8EBEEFF9U, 0x17B7BE43U, 0x60B08ED5U,
-            0xD6D6A3E8U, 0xA1D1937EU, 0x38D8C2C4U, 0x4FDFF252U, 0xD1BB67F1U, 0xA6BC5767U, 0x3FB506DDU, 0x48B2364BU,
-            0xD80D2BDAU, 0xAF0A1B4CU, 0x36034AF6U, 0x41047A60U, 0xDF60EFC3U, 0xA867DF55U, 0x316E8EEFU, 0x4669BE79U,
-            0xCB61B38CU, 0xBC66831AU, 0x256FD2A0U, 0x5268E236U, 0xCC0C7795U, 0xBB0B4703U, 0x220216B9U, 0x5505262FU,
-            0xC5BA3BBEU, 0xB2BD0B28U, 0x2BB45A92U, 0x5CB36A04U, 0xC2D7FFA7U, 0xB5D0CF31U, 0x2CD99E8BU, 0x5BDEAE1DU,
-            0x9B64C2B0U, 0xEC63F226U, 0x756AA39CU, 0x026D930AU, 0x9C0906A9U, 0xEB0E363FU, 0x72076785U, 0x05005713U,
-            0x95BF4A82U, 0xE2B87A14U, 0x7BB12BAEU, 0x0CB61B38U, 0x92D28E9BU, 0xE5D5BE0DU, 0x7CDCEFB7U, 0x0BDBDF21U,
-            0x86D3D2D4U, 0xF1D4E242U, 0x68DDB3F8U, 0x1FDA836EU, 0x81BE16CDU, 0xF6B9265BU, 0x6FB077E1U, 0x18B74777U,
-            0x88085AE6U, 0xFF0F6A70U, 0x66063BCAU, 0x11010B5CU, 0x8F659EFFU, 0xF862AE69U, 0x616BFFD3U, 0x166CCF45U,
-            0xA00AE278U, 0xD70DD2EEU, 0x4E048354U, 0x3903B3C2U, 0xA7672661U, 0xD06016F7U, 0x4969474DU, 0x3E6E77DBU,
-            0xAED16A4AU, 0xD9D65ADCU, 0x40DF0B66U, 0x37D83BF0U, 0xA9BCAE53U, 0xDEBB9EC5U, 0x47B2CF7FU, 0x30B5FFE9U,
-            0xBDBDF21CU, 0xCABAC28AU, 0x53B39330U, 0x24B4A3A6U, 0xBAD03605U, 0xCDD70693U, 0x54DE5729U, 0x23D967BFU,
-            0xB3667A2EU, 0xC4614AB8U, 0x5D681B02U, 0x2A6F2B94U, 0xB40BBE37U, 0xC30C8EA1U, 0x5A05DF1BU, 0x2D02EF8DU
-        };
+        template <std::size_t width>
+        using Register = std::conditional_t<(width <= 8), std::uint8_t,
+            std::conditional_t<(width <= 16), std::uint16_t,
+            std::conditional_t<(width <= 32), std::uint32_t, std::uint64_t>>>;
 
-        template <> constexpr std::uint32_t getEntry<std::uint32_t>(std::uint8_t i) noexcept
+        constexpr std::uint64_t getMask(const std::size_t bits) noexcept
         {
-            return table32[i];
+            return (bits >= 64) ? ~std::uint64_t(0) : (std::uint64_t(1) << bits) - 1U;
         }
-
-        template <> constexpr std::uint32_t getInit() noexcept
-        {
-            return 0xFFFFFFFFU;
-        }
-
-        template <> constexpr std::uint32_t getXorOut() noexcept
-        {
-            return 0xFFFFFFFFU;
+
+        constexpr std::uint64_t reflect(std::uint64_t value, const std::size_t bits) noexcept
+        {
+            std::uint64_t result = 0;
+            for (std::size_t i = 0; i < bits; ++i, value >>= 1)
+                result = (result << 1) | (value & 1U);
+            return result;
+        }
+
+        constexpr std::size_t sliceCount = 8; // number of bytes processed per slicing step
+        template <typename T> using Tables = std::array<std::array<T, 256>, sliceCount>;
+
+        // tables[0] is the classic byte-wise table, tables[n] advances an entry of tables[n - 1] by one more zero byte
+        template <typename T, std::size_t width, std::uint64_t poly, bool reflected>
+        constexpr Tables<T> generateTables() noexcept
+        {
+            constexpr std::size_t bits = sizeof(T) * 8;
+            Tables<T> result{};
+
+            for (std::uint32_t i = 0; i < 256; ++i)
+            {
+                std::uint64_t entry = 0;
+                if constexpr (reflected)
+                {
+                    constexpr std::uint64_t reflectedPoly = reflect(poly, width);
+                    entry = i;
+                    for (std::uint32_t bit = 0; bit < 8; ++bit)
+                        entry = (entry & 1U) ? (entry >> 1) ^ reflectedPoly : entry >> 1;
+                }
+                else
+                {
+                    // the register is kept left-aligned, so widths that are not a multiple of 8 need no special casing
+                    constexpr std::uint64_t alignedPoly = (poly << (bits - width)) & getMask(bits);
+                    constexpr std::uint64_t topBit = std::uint64_t(1) << (bits - 1);
+                    entry = static_cast<std::uint64_t>(i) << (bits - 8);
+                    for (std::uint32_t bit = 0; bit < 8; ++bit)
+                        entry = ((entry & topBit) ? (entry << 1) ^ alignedPoly : entry << 1) & getMask(bits);
+                }
+                result[0][i] = static_cast<T>(entry);
+            }
+
+            for (std::size_t n = 1; n < sliceCount; ++n)
+                for (std::uint32_t i = 0; i < 256; ++i)
+                {
+                    const T previous = result[n - 1][i];
+                    if constexpr (reflected)
+                        result[n][i] = static_cast<T>((static_cast<std::uint64_t>(previous) >> 8) ^ result[0][previous & 0xFFU]);
+                    else
+                        result[n][i] = static_cast<T>(((static_cast<std::uint64_t>(previous) << 8) & getMask(bits)) ^
+                                                      result[0][static_cast<std::uint64_t>(previous) >> (bits - 8)]);
+                }
+
+            return result;
+        }
+
+        template <typename T, std::size_t width, std::uint64_t poly, bool reflected>
+        constexpr Tables<T> tables = generateTables<T, width, poly, reflected>();
+
+        constexpr bool isConstantEvaluated() noexcept
+        {
+#if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+            return __builtin_is_constant_evaluated();
+#else
+            return true; // no way to tell, so always take the portable path
+#endif
+        }
+
+        template <class T, class = void>
+        struct IsContiguous: std::false_type {};
+
+        template <class T>
+        struct IsContiguous<T, std::void_t<decltype(std::data(std::declval<const T&>())),
+                                           decltype(std::size(std::declval<const T&>()))>>: std::true_type {};
+
+        template <class Data>
+        constexpr auto getBegin(const Data& v) noexcept
+        {
+            if constexpr (IsContiguous<Data>::value) return std::data(v);
+            else return std::begin(v);
+        }
+
+        template <class Data>
+        constexpr auto getEnd(const Data& v) noexcept
+        {
+            if constexpr (IsContiguous<Data>::value) return std::data(v) + std::size(v);
+            else return std::end(v);
+        }
+
+#ifdef CPU_X86
+        // x^n mod P for a 64-bit polynomial (without the implicit x^64 term)
+        constexpr std::uint64_t powerMod(const std::uint64_t poly, const std::size_t n) noexcept
+        {
+            std::uint64_t result = 1;
+            for (std::size_t i = 0; i < n; ++i)
+                result = (result & 0x8000000000000000ULL) ? (result << 1) ^ poly : result << 1;
+            return result;
+        }
+
+        // constants to move a 128-bit lane forward by distance bits
+        template <std::uint64_t poly, bool reflected, std::size_t distance>
+        CPU_TARGET("pclmul,ssse3") inline __m128i getFoldConstants() noexcept
+        {
+            // the reflected product of two 64-bit values is one bit short, so it is compensated in the constants
+            if constexpr (reflected)
+                return _mm_set_epi64x(static_cast<long long>(reflect(powerMod(poly, distance - 1), 64)),
+                                      static_cast<long long>(reflect(powerMod(poly, distance + 63), 64)));
+            else
+                return _mm_set_epi64x(static_cast<long long>(powerMod(poly, distance + 64)),
+                                      static_cast<long long>(powerMod(poly, distance)));
+        }
+
+        CPU_TARGET("pclmul,ssse3") inline __m128i fold(const __m128i value, const __m128i constants) noexcept
+        {
+            return _mm_xor_si128(_mm_clmulepi64_si128(value, constants, 0x00),
+                                 _mm_clmulepi64_si128(value, constants, 0x11));
+        }
+
+        template <bool reflected>
+        CPU_TARGET("pclmul,ssse3") inline __m128i load(const std::uint8_t* data) noexcept
+        {
+            const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+            if constexpr (reflected)
+                return value;
+            else
+                return _mm_shuffle_epi8(value, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+        }
+
+        // Folds 16-byte blocks of data into a single block with PCLMULQDQ (four lanes in parallel while
+        // there is enough data) and returns the number of bytes consumed. The CRC of data is the CRC of
+        // the remainder with a zero register.
+        template <std::uint64_t poly, bool reflected>
+        CPU_TARGET("pclmul,ssse3") std::size_t fold(const std::uint64_t crc, const std::uint8_t* data,
+                                                    const std::size_t size,
+                                                    std::array<std::uint8_t, 16>& remainder) noexcept
+        {
+            const __m128i initial = reflected ?
+                _mm_set_epi64x(0, static_cast<long long>(crc)) :
+                _mm_set_epi64x(static_cast<long long>(crc), 0);
+
+            std::size_t offset = 0;
+            __m128i x;
+
+            if (size >= 128)
+            {
+                const __m128i k512 = getFoldConstants<poly, reflected, 512>();
+                __m128i x0 = _mm_xor_si128(load<reflected>(data), initial);
+                __m128i x1 = load<reflected>(data + 16);
+                __m128i x2 = load<reflected>(data + 32);
+                __m128i x3 = load<reflected>(data + 48);
+
+                for (offset = 64; size - offset >= 64; offset += 64)
+                {
+                    x0 = _mm_xor_si128(fold(x0, k512), load<reflected>(data + offset));
+                    x1 = _mm_xor_si128(fold(x1, k512), load<reflected>(data + offset + 16));
+                    x2 = _mm_xor_si128(fold(x2, k512), load<reflected>(data + offset + 32));
+                    x3 = _mm_xor_si128(fold(x3, k512), load<reflected>(data + offset + 48));
+                }
+
+                x = _mm_xor_si128(_mm_xor_si128(fold(x0, getFoldConstants<poly, reflected, 384>()),
+                                                 fold(x1, getFoldConstants<poly, reflected, 256>())),
+                                  _mm_xor_si128(fold(x2, getFoldConstants<poly, reflected, 128>()), x3));
+            }
+            else
+            {
+                x = _mm_xor_si128(load<reflected>(data), initial);
+                offset = 16;
+            }
+
+            const __m128i k128 = getFoldConstants<poly, reflected, 128>();
+            for (; size - offset >= 16; offset += 16)
+                x = _mm_xor_si128(fold(x, k128), load<reflected>(data + offset));
+
+            if constexpr (!reflected)
+                x = _mm_shuffle_epi8(x, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(remainder.data()), x);
+
+            return offset;
         }
+#endif
     }
 
+    // Parametrized CRC following the Rocksoft model (as used by the CRC RevEng catalogue)
+    template <std::size_t width, std::uint64_t poly, std::uint64_t init,
+              bool refIn, bool refOut, std::uint64_t xorOut>
+    class Engine final
+    {
+        static_assert(width >= 1 && width <= 64, "Invalid CRC width");
+
+    public:
+        using Value = Register<width>;
+
+        // the internal register is reflected when refIn is set and left-aligned otherwise
+        static constexpr Value getInitialState() noexcept
+        {
+            return refIn ?
+                static_cast<Value>(reflect(init, width)) :
+                static_cast<Value>((init & getMask(width)) << shift);
+        }
+
+        template <class Iterator>
+        static constexpr Value update(const Value state,
+                                      Iterator i, const Iterator end) noexcept
+        {
+            const auto& t = tables<Value, width, poly, refIn>;
+            std::uint64_t crc = state;
+
+#ifdef CPU_X86
+            if constexpr (width == 64 && std::is_pointer_v<Iterator> &&
+                          sizeof(typename std::iterator_traits<Iterator>::value_type) == 1)
+                if (!isConstantEvaluated() && end - i >= 64 &&
+                    cpu::hasFeatures(cpu::Feature::pclmul | cpu::Feature::ssse3))
+                {
+                    std::array<std::uint8_t, 16> remainder;
+                    const auto data = reinterpret_cast<const std::uint8_t*>(i);
+                    i += fold<poly, refIn>(crc, data, static_cast<std::size_t>(end - i), remainder);
+                    crc = update(0, remainder.begin(), remainder.end());
+                }
+#endif
+
+            if constexpr (std::is_base_of_v<std::random_access_iterator_tag,
+                                            typename std::iterator_traits<Iterator>::iterator_category>)
+            {
+                for (; end - i >= static_cast<std::ptrdiff_t>(sliceCount); i += sliceCount)
+                {
+                    if constexpr (refIn)
+                    {
+                        const std::uint64_t v = crc ^
+                            (static_cast<std::uint64_t>(static_cast<std::uint8_t>(i[0])) |
+                             (static_cast<std::uint64_t>(static_cast<std::uint8_t>(i[1])) << 8) |
+                             (static_cast<std::uint64_t>(static_cast<std::uint8_t>(i[2])) << 16) |
+                             (static_cast<std::uint64_t>(static_cast<std::uint8_t>(i[3])) << 24) |
+                             (static_cast<std::uint64_t>(static_cast<std::uint8_t>(i[4])) << 32) |
+                             (static_cast<std::uint64_t>(static_cast<std::uint8_t>(i[5])) << 40) |
+                             (static_cast<std::uint64_t>(static_cast<std::uint8_t>(i[6])) << 48) |
+                             (static_cast<std::uint64_t>(static_cast<std::uint8_t>(i[7])) << 56));
+
+                        crc = t[7][v & 0xFFU] ^ t[6][(v >> 8) & 0xFFU] ^
+                            t[5][(v >> 16) & 0xFFU] ^ t[4][(v >> 24) & 0xFFU] ^
+                            t[3][(v >> 32) & 0xFFU] ^ t[2][(v >> 40) & 0xFFU] ^
+                            t[1][(v >> 48) & 0xFFU] ^ t[0][v >> 56];
+                    }
+                    else
+                    {
+                        const std::uint64_t v = (crc << (64 - bits)) ^
+                            ((static_cast<std::uint64_t>(static_cast<std::uint8_t>(i[0])) << 56) |
+                             (static_cast<std::uint64_t>(static_cast<std::uint8_t>(i[1])) << 48) |
+                             (static_cast<std::uint64_t>(static_cast<std::uint8_t>(i[2])) << 40) |
+                             (static_cast<std::uint64_t>(static_cast<std::uint8_t>(i[3])) << 32) |
+                             (static_cast<std::uint64_t>(static_cast<std::uint8_t>(i[4])) << 24) |
+                             (static_cast<std::uint64_t>(static_cast<std::uint8_t>(i[5])) << 16) |
+                             (static_cast<std::uint64_t>(static_cast<std::uint8_t>(i[6])) << 8) |
+                             static_cast<std::uint64_t>(static_cast<std::uint8_t>(i[7])));
+
+                        crc = t[7][v >> 56] ^ t[6][(v >> 48) & 0xFFU] ^
+                            t[5][(v >> 40) & 0xFFU] ^ t[4][(v >> 32) & 0xFFU] ^
+                            t[3][(v >> 24) & 0xFFU] ^ t[2][(v >> 16) & 0xFFU] ^
+                            t[1][(v >> 8) & 0xFFU] ^ t[0][v & 0xFFU];
+                    }
+                }
+            }
+
+            for (; i != end; ++i)
+            {
+                const auto b = static_cast<std::uint8_t>(*i);
+                if constexpr (refIn)
+                    crc = (crc >> 8) ^ t[0][(crc ^ b) & 0xFFU];
+                else
+                    crc = ((crc << 8) & getMask(bits)) ^ t[0][((crc >> (bits - 8)) ^ b) & 0xFFU];
+            }
+
+            return static_cast<Value>(crc);
+        }
+
+        static constexpr Value finalize(const Value state) noexcept
+        {
+            std::uint64_t crc = refIn ? state : static_cast<std::uint64_t>(state) >> shift;
+            if constexpr (refIn != refOut) crc = reflect(crc, width);
+            return static_cast<Value>((crc ^ xorOut) & getMask(width));
+        }
+
+        template <class Iterator>
+        static constexpr Value generate(const Iterator begin, const Iterator end) noexcept
+        {
+            return finalize(update(getInitialState(), begin, end));
+        }
+
+        template <class Data>
+        static constexpr Value generate(const Data& v) noexcept
+        {
+            return generate(getBegin(v), getEnd(v));
+        }
+
+        template <class T, std::enable_if_t<sizeof(T) == 1>* = nullptr>
+        static constexpr Value generate(const T* input, const std::size_t size) noexcept
+        {
+            return generate(input, input + size);
+        }
+
+    private:
+        static constexpr std::size_t bits = sizeof(Value) * 8;
+        static constexpr std::size_t shift = bits - width;
+    };
+
+    using Crc8 = Engine<8, 0x07U, 0x00U, false, false, 0x00U>; // CRC-8/SMBUS
+    using Crc16Kermit = Engine<16, 0x1021U, 0x0000U, true, true, 0x0000U>;
+    using Crc16Ccitt = Engine<16, 0x1021U, 0xFFFFU, false, false, 0x0000U>; // CRC-16/CCITT-FALSE
+    using Crc16Xmodem = Engine<16, 0x1021U, 0x0000U, false, false, 0x0000U>;
+    using Crc32 = Engine<32, 0x04C11DB7U, 0xFFFFFFFFU, true, true, 0xFFFFFFFFU>;
+    using Crc32c = Engine<32, 0x1EDC6F41U, 0xFFFFFFFFU, true, true, 0xFFFFFFFFU>;
+    using Crc64Ecma = Engine<64, 0x42F0E1EBA9EA3693ULL, 0x0000000000000000ULL, false, false, 0x0000000000000000ULL>; // CRC-64/ECMA-182
+    using Crc64Xz = Engine<64, 0x42F0E1EBA9EA3693ULL, 0xFFFFFFFFFFFFFFFFULL, true, true, 0xFFFFFFFFFFFFFFFFULL>;
+    using Crc64Nvme = Engine<64, 0xAD93D23594C93659ULL, 0xFFFFFFFFFFFFFFFFULL, true, true, 0xFFFFFFFFFFFFFFFFULL>;
+
+    inline namespace detail
+    {
+        // algorithm used by crc::generate for each result type
+        template <typename T> struct Default;
+        template <> struct Default<std::uint8_t> final { using Type = Crc8; };
+        template <> struct Default<std::uint16_t> final { using Type = Crc16Kermit; };
+        template <> struct Default<std::uint32_t> final { using Type = Crc32; };
+        template <> struct Default<std::uint64_t> final { using Type = Crc64Xz; };
+
+        template <typename T> constexpr T getInit() noexcept
+        {
+            return Default<T>::Type::getInitialState();
+        }
+
+        template <typename T> constexpr T getXorOut() noexcept
+        {
+            return Default<T>::Type::finalize(0);
+        }
+    }
+
+    // all of the default algorithms are fully reflected, so the register can be passed back in as init
     template <typename T, T xorOut = getXorOut<T>(), class Iterator>
     constexpr T generate(const Iterator i, const Iterator end,
                          const T init = getInit<T>()) noexcept
     {
-        return ((i != end) ? generate<T, T(0)>(i + 1, end, static_cast<T>(static_cast<std::uint32_t>(init) >> 8) ^ getEntry<T>(static_cast<std::uint8_t>(init ^ static_cast<std::uint8_t>(*i)))) : init) ^ xorOut;
+        return static_cast<T>(Default<T>::Type::update(init, i, end) ^ xorOut);
     }
 
     template <class T, class Data>
     constexpr T generate(const Data& v) noexcept
     {
-        return generate<T>(std::begin(v), std::end(v));
+        return generate<T>(getBegin(v), getEnd(v));
+    }
+
+    template <typename T, T xorOut = getXorOut<T>(), class U, std::enable_if_t<sizeof(U) == 1>* = nullptr>
+    constexpr T generate(const U* input, const std::size_t size,
+                         const T init = getInit<T>()) noexcept
+    {
+        return generate<T, xorOut>(input, input + size, init);
     }
 }
 
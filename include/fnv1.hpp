@@ -5,7 +5,11 @@
 #ifndef FNV_HPP
 #define FNV_HPP
 
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
 
 namespace fnv1
 {
@@ -24,13 +28,55 @@ namespace fnv1
             static constexpr std::uint64_t prime = 1099511628211ULL;
             static constexpr std::uint64_t offsetBasis = 14695981039346656037ULL;
         };
+
+        // FNV-1 multiplies before mixing in the byte, FNV-1a mixes in the byte first
+        template <bool alternate, typename Result>
+        constexpr Result step(const Result result, const std::uint8_t b) noexcept
+        {
+            return alternate ?
+                static_cast<Result>((result ^ b) * Constants<Result>::prime) :
+                static_cast<Result>((result * Constants<Result>::prime) ^ b);
+        }
+
+        template <bool alternate, typename Result, typename Iterator>
+        constexpr Result process(Iterator i, const Iterator end, Result result) noexcept
+        {
+            if constexpr (std::is_base_of_v<std::random_access_iterator_tag,
+                                            typename std::iterator_traits<Iterator>::iterator_category>)
+                for (; end - i >= 8; i += 8)
+                {
+                    // gather 8 bytes into one word (a single load for contiguous memory)
+                    const std::uint64_t word = static_cast<std::uint64_t>(static_cast<std::uint8_t>(i[0])) |
+                        (static_cast<std::uint64_t>(static_cast<std::uint8_t>(i[1])) << 8) |
+                        (static_cast<std::uint64_t>(static_cast<std::uint8_t>(i[2])) << 16) |
+                        (static_cast<std::uint64_t>(static_cast<std::uint8_t>(i[3])) << 24) |
+                        (static_cast<std::uint64_t>(static_cast<std::uint8_t>(i[4])) << 32) |
+                        (static_cast<std::uint64_t>(static_cast<std::uint8_t>(i[5])) << 40) |
+                        (static_cast<std::uint64_t>(static_cast<std::uint8_t>(i[6])) << 48) |
+                        (static_cast<std::uint64_t>(static_cast<std::uint8_t>(i[7])) << 56);
+
+                    result = step<alternate>(result, static_cast<std::uint8_t>(word));
+                    result = step<alternate>(result, static_cast<std::uint8_t>(word >> 8));
+                    result = step<alternate>(result, static_cast<std::uint8_t>(word >> 16));
+                    result = step<alternate>(result, static_cast<std::uint8_t>(word >> 24));
+                    result = step<alternate>(result, static_cast<std::uint8_t>(word >> 32));
+                    result = step<alternate>(result, static_cast<std::uint8_t>(word >> 40));
+                    result = step<alternate>(result, static_cast<std::uint8_t>(word >> 48));
+                    result = step<alternate>(result, static_cast<std::uint8_t>(word >> 56));
+                }
+
+            for (; i != end; ++i)
+                result = step<alternate>(result, static_cast<std::uint8_t>(*i));
+
+            return result;
+        }
     }
 
     template <typename Result, typename Iterator>
     constexpr Result hash(const Iterator i, const Iterator end,
                           const Result result = Constants<Result>::offsetBasis) noexcept
     {
-        return (i != end) ? hash(i + 1, end, (result * Constants<Result>::prime) ^ static_cast<std::uint8_t>(*i)) : result;
+        return process<false>(i, end, result);
     }
 
     template <typename Result, typename T>
@@ -38,6 +84,85 @@ namespace fnv1
     {
         return hash<Result>(std::begin(v), std::end(v));
     }
+
+    template <typename Result, typename T, std::enable_if_t<sizeof(T) == 1>* = nullptr>
+    constexpr Result hash(const T* input, const std::size_t size,
+                          const Result result = Constants<Result>::offsetBasis) noexcept
+    {
+        return process<false>(input, input + size, result);
+    }
+
+    // hasher for unordered containers, transparent so that std::string keys can be looked up by std::string_view
+    template <typename Result = std::conditional_t<sizeof(std::size_t) == 8, std::uint64_t, std::uint32_t>>
+    struct Hash final
+    {
+        using is_transparent = void;
+
+        constexpr std::size_t operator()(const std::string_view s) const noexcept
+        {
+            return static_cast<std::size_t>(hash<Result>(s));
+        }
+    };
+
+    inline namespace literals
+    {
+        constexpr std::uint32_t operator""_fnv132(const char* s, const std::size_t length) noexcept
+        {
+            return hash<std::uint32_t>(s, s + length);
+        }
+
+        constexpr std::uint64_t operator""_fnv164(const char* s, const std::size_t length) noexcept
+        {
+            return hash<std::uint64_t>(s, s + length);
+        }
+    }
+}
+
+namespace fnv1a
+{
+    template <typename Result, typename Iterator>
+    constexpr Result hash(const Iterator i, const Iterator end,
+                          const Result result = fnv1::Constants<Result>::offsetBasis) noexcept
+    {
+        return fnv1::process<true>(i, end, result);
+    }
+
+    template <typename Result, typename T>
+    constexpr Result hash(const T& v) noexcept
+    {
+        return hash<Result>(std::begin(v), std::end(v));
+    }
+
+    template <typename Result, typename T, std::enable_if_t<sizeof(T) == 1>* = nullptr>
+    constexpr Result hash(const T* input, const std::size_t size,
+                          const Result result = fnv1::Constants<Result>::offsetBasis) noexcept
+    {
+        return fnv1::process<true>(input, input + size, result);
+    }
+
+    template <typename Result = std::conditional_t<sizeof(std::size_t) == 8, std::uint64_t, std::uint32_t>>
+    struct Hash final
+    {
+        using is_transparent = void;
+
+        constexpr std::size_t operator()(const std::string_view s) const noexcept
+        {
+            return static_cast<std::size_t>(hash<Result>(s));
+        }
+    };
+
+    inline namespace literals
+    {
+        constexpr std::uint32_t operator""_fnv1a32(const char* s, const std::size_t length) noexcept
+        {
+            return hash<std::uint32_t>(s, s + length);
+        }
+
+        constexpr std::uint64_t operator""_fnv1a64(const char* s, const std::size_t length) noexcept
+        {
+            return hash<std::uint64_t>(s, s + length);
+        }
+    }
 }
 
 #endif // FNV_HPP
@@ -0,0 +1,385 @@
+//
+// Header-only libs
+//
+
+#ifndef HEX_HPP
+#define HEX_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "cpu.hpp"
+
+namespace hex
+{
+    class ParseError final: public std::logic_error
+    {
+    public:
+        explicit ParseError(const std::string& str): std::logic_error(str) {}
+        explicit ParseError(const char* str): std::logic_error(str) {}
+    };
+
+    enum class Error
+    {
+        none,
+        invalidCharacter,
+        invalidLength,
+        outputTooSmall
+    };
+
+    struct DecodeResult final
+    {
+        std::size_t size; // number of bytes written
+        Error error;
+        std::size_t position; // offset of the offending character, or of the end of the decoded data
+    };
+
+    constexpr std::size_t encodedSize(const std::size_t size) noexcept
+    {
+        return size * 2;
+    }
+
+    constexpr std::size_t decodedSize(const std::size_t length) noexcept
+    {
+        return length / 2;
+    }
+
+    inline namespace detail
+    {
+        template <class T, class = void>
+        struct IsContiguous: std::false_type {};
+
+        template <class T>
+        struct IsContiguous<T, std::void_t<decltype(std::data(std::declval<const T&>())),
+                                           decltype(std::size(std::declval<const T&>()))>>: std::true_type {};
+
+        template <class Iterator>
+        constexpr bool isBytePointer = std::is_pointer_v<Iterator> &&
+            sizeof(typename std::iterator_traits<Iterator>::value_type) == 1;
+
+        constexpr std::array<char, 16> lowerDigits = {
+            '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'
+        };
+
+        constexpr std::array<char, 16> upperDigits = {
+            '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'
+        };
+
+        constexpr std::array<std::uint8_t, 256> generateReverse() noexcept
+        {
+            std::array<std::uint8_t, 256> result{};
+            for (auto& value : result) value = 0xFF;
+            for (std::uint8_t i = 0; i < 16; ++i)
+            {
+                result[static_cast<std::uint8_t>(lowerDigits[i])] = i;
+                result[static_cast<std::uint8_t>(upperDigits[i])] = i;
+            }
+            return result;
+        }
+
+        constexpr std::array<std::uint8_t, 256> reverse = generateReverse();
+
+#ifdef CPU_X86
+        // 16 bytes to 32 characters per step
+        CPU_TARGET("ssse3") inline std::size_t encodeSsse3(const std::uint8_t* input, const std::size_t size,
+                                                           char* output, const bool uppercase) noexcept
+        {
+            const auto& digits = uppercase ? upperDigits : lowerDigits;
+            const __m128i lookup = _mm_loadu_si128(reinterpret_cast<const __m128i*>(digits.data()));
+            const __m128i mask = _mm_set1_epi8(0x0F);
+
+            std::size_t i = 0;
+            for (; size - i >= 16; i += 16, output += 32)
+            {
+                const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+                const __m128i high = _mm_shuffle_epi8(lookup, _mm_and_si128(_mm_srli_epi16(in, 4), mask));
+                const __m128i low = _mm_shuffle_epi8(lookup, _mm_and_si128(in, mask));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm_unpacklo_epi8(high, low));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 16), _mm_unpackhi_epi8(high, low));
+            }
+            return i;
+        }
+
+        // 32 bytes to 64 characters per step
+        CPU_TARGET("avx2") inline std::size_t encodeAvx2(const std::uint8_t* input, const std::size_t size,
+                                                         char* output, const bool uppercase) noexcept
+        {
+            const auto& digits = uppercase ? upperDigits : lowerDigits;
+            const __m256i lookup = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(digits.data())));
+            const __m256i mask = _mm256_set1_epi8(0x0F);
+
+            std::size_t i = 0;
+            for (; size - i >= 32; i += 32, output += 64)
+            {
+                const __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+                const __m256i high = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(in, 4), mask));
+                const __m256i low = _mm256_shuffle_epi8(lookup, _mm256_and_si256(in, mask));
+                const __m256i first = _mm256_unpacklo_epi8(high, low);
+                const __m256i second = _mm256_unpackhi_epi8(high, low);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), _mm256_permute2x128_si256(first, second, 0x20));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + 32), _mm256_permute2x128_si256(first, second, 0x31));
+            }
+            return i + encodeSsse3(input + i, size - i, output, uppercase);
+        }
+
+        // characters to nibbles, the mask has a bit set for every invalid character
+        CPU_TARGET("ssse3") inline __m128i lookupSsse3(const __m128i in, int& invalid) noexcept
+        {
+            const __m128i lowered = _mm_or_si128(in, _mm_set1_epi8(0x20));
+            const __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('0' - 1)),
+                                                _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), in));
+            const __m128i letter = _mm_and_si128(_mm_cmpgt_epi8(lowered, _mm_set1_epi8('a' - 1)),
+                                                 _mm_cmpgt_epi8(_mm_set1_epi8('f' + 1), lowered));
+            invalid = _mm_movemask_epi8(_mm_or_si128(digit, letter)) ^ 0xFFFF;
+
+            return _mm_or_si128(_mm_and_si128(digit, _mm_sub_epi8(in, _mm_set1_epi8('0'))),
+                                _mm_and_si128(letter, _mm_sub_epi8(lowered, _mm_set1_epi8('a' - 10))));
+        }
+
+        // 32 characters to 16 bytes per step, stops at the first block with an invalid character
+        CPU_TARGET("ssse3") inline std::size_t decodeSsse3(const char* input, const std::size_t length,
+                                                           std::uint8_t* output) noexcept
+        {
+            const __m128i weights = _mm_set1_epi16(0x0110);
+
+            std::size_t i = 0;
+            for (; length - i >= 32; i += 32, output += 16)
+            {
+                int invalidFirst;
+                int invalidSecond;
+                const __m128i first = lookupSsse3(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i)), invalidFirst);
+                const __m128i second = lookupSsse3(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 16)), invalidSecond);
+                if (invalidFirst | invalidSecond) break;
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output),
+                                 _mm_packus_epi16(_mm_maddubs_epi16(first, weights), _mm_maddubs_epi16(second, weights)));
+            }
+            return i;
+        }
+
+        CPU_TARGET("avx2") inline __m256i lookupAvx2(const __m256i in, int& invalid) noexcept
+        {
+            const __m256i lowered = _mm256_or_si256(in, _mm256_set1_epi8(0x20));
+            const __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(in, _mm256_set1_epi8('0' - 1)),
+                                                   _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), in));
+            const __m256i letter = _mm256_and_si256(_mm256_cmpgt_epi8(lowered, _mm256_set1_epi8('a' - 1)),
+                                                    _mm256_cmpgt_epi8(_mm256_set1_epi8('f' + 1), lowered));
+            invalid = ~_mm256_movemask_epi8(_mm256_or_si256(digit, letter));
+
+            return _mm256_or_si256(_mm256_and_si256(digit, _mm256_sub_epi8(in, _mm256_set1_epi8('0'))),
+                                   _mm256_and_si256(letter, _mm256_sub_epi8(lowered, _mm256_set1_epi8('a' - 10))));
+        }
+
+        // 64 characters to 32 bytes per step
+        CPU_TARGET("avx2") inline std::size_t decodeAvx2(const char* input, const std::size_t length,
+                                                         std::uint8_t* output) noexcept
+        {
+            const __m256i weights = _mm256_set1_epi16(0x0110);
+
+            std::size_t i = 0;
+            for (; length - i >= 64; i += 64, output += 32)
+            {
+                int invalidFirst;
+                int invalidSecond;
+                const __m256i first = lookupAvx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i)), invalidFirst);
+                const __m256i second = lookupAvx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i + 32)), invalidSecond);
+                if (invalidFirst | invalidSecond) break;
+
+                // packing works on 128-bit lanes, so the middle quarters have to be swapped afterwards
+                const __m256i packed = _mm256_packus_epi16(_mm256_maddubs_epi16(first, weights),
+                                                           _mm256_maddubs_epi16(second, weights));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), _mm256_permute4x64_epi64(packed, 0xD8));
+            }
+            return i + decodeSsse3(input + i, length - i, output);
+        }
+#endif
+
+        // the SIMD kernel picked once for this CPU, each one finishes its tail with the narrower kernel
+        inline std::size_t encodeBlocks(const std::uint8_t* input, const std::size_t size,
+                                        char* output, const bool uppercase) noexcept
+        {
+#ifdef CPU_X86
+            static const auto encode = cpu::select<decltype(&encodeSsse3)>({
+                {cpu::Feature::avx2, encodeAvx2},
+                {cpu::Feature::ssse3, encodeSsse3}
+            }, nullptr);
+            return encode ? encode(input, size, output, uppercase) : 0;
+#else
+            (void)input;
+            (void)size;
+            (void)output;
+            (void)uppercase;
+            return 0;
+#endif
+        }
+
+        inline std::size_t decodeBlocks(const char* input, const std::size_t length, std::uint8_t* output) noexcept
+        {
+#ifdef CPU_X86
+            static const auto decode = cpu::select<decltype(&decodeSsse3)>({
+                {cpu::Feature::avx2, decodeAvx2},
+                {cpu::Feature::ssse3, decodeSsse3}
+            }, nullptr);
+            return decode ? decode(input, length, output) : 0;
+#else
+            (void)input;
+            (void)length;
+            (void)output;
+            return 0;
+#endif
+        }
+
+        inline std::size_t encodeBuffer(const std::uint8_t* input, const std::size_t size,
+                                        char* output, const bool uppercase) noexcept
+        {
+            const auto& digits = uppercase ? upperDigits : lowerDigits;
+            std::size_t i = encodeBlocks(input, size, output, uppercase);
+
+            for (; i != size; ++i)
+            {
+                output[i * 2] = digits[input[i] >> 4];
+                output[i * 2 + 1] = digits[input[i] & 0x0F];
+            }
+
+            return size * 2;
+        }
+
+        inline DecodeResult decodeBuffer(const char* input, const std::size_t length,
+                                         std::uint8_t* output, const std::size_t capacity) noexcept
+        {
+            if (capacity < length / 2) return {0, Error::outputTooSmall, 0};
+
+            std::size_t i = decodeBlocks(input, length, output);
+
+            for (; length - i >= 2; i += 2)
+            {
+                const std::uint8_t high = reverse[static_cast<std::uint8_t>(input[i])];
+                const std::uint8_t low = reverse[static_cast<std::uint8_t>(input[i + 1])];
+                if (high > 15) return {i / 2, Error::invalidCharacter, i};
+                if (low > 15) return {i / 2, Error::invalidCharacter, i + 1};
+                output[i / 2] = static_cast<std::uint8_t>((high << 4) | low);
+            }
+
+            if (i != length)
+                return {i / 2, reverse[static_cast<std::uint8_t>(input[i])] > 15 ?
+                    Error::invalidCharacter : Error::invalidLength, i};
+
+            return {i / 2, Error::none, i};
+        }
+    }
+
+    // writes encodedSize(size) characters, returns the number written
+    template <class T, std::enable_if_t<sizeof(T) == 1>* = nullptr>
+    std::size_t encode(const T* input, const std::size_t size, char* output, const bool uppercase = false) noexcept
+    {
+        return encodeBuffer(reinterpret_cast<const std::uint8_t*>(input), size, output, uppercase);
+    }
+
+    template <class Iterator>
+    std::string encode(const Iterator begin, const Iterator end, const bool uppercase = false)
+    {
+        std::string result;
+
+        if constexpr (isBytePointer<Iterator>)
+        {
+            const auto size = static_cast<std::size_t>(end - begin);
+            result.resize(encodedSize(size));
+            encodeBuffer(reinterpret_cast<const std::uint8_t*>(begin), size, &result[0], uppercase);
+        }
+        else
+        {
+            const auto& digits = uppercase ? upperDigits : lowerDigits;
+            for (auto i = begin; i != end; ++i)
+            {
+                const auto b = static_cast<std::uint8_t>(*i);
+                result += digits[b >> 4];
+                result += digits[b & 0x0F];
+            }
+        }
+
+        return result;
+    }
+
+    template <class T>
+    std::string encode(const T& v, const bool uppercase = false)
+    {
+        if constexpr (IsContiguous<T>::value)
+            return encode(std::data(v), std::data(v) + std::size(v), uppercase);
+        else
+            return encode(std::begin(v), std::end(v), uppercase);
+    }
+
+    // fixed-size output for digests, no allocation
+    template <class T, std::size_t size, std::enable_if_t<sizeof(T) == 1>* = nullptr>
+    std::array<char, size * 2> toHex(const std::array<T, size>& digest, const bool uppercase = false) noexcept
+    {
+        std::array<char, size * 2> result;
+        encodeBuffer(reinterpret_cast<const std::uint8_t*>(digest.data()), size, result.data(), uppercase);
+        return result;
+    }
+
+    // writes at most capacity bytes, reports invalid input through the result instead of throwing
+    inline DecodeResult decode(const char* input, const std::size_t length,
+                               std::uint8_t* output, const std::size_t capacity) noexcept
+    {
+        return decodeBuffer(input, length, output, capacity);
+    }
+
+    template <class Iterator>
+    std::vector<std::uint8_t> decode(const Iterator begin, const Iterator end)
+    {
+        std::vector<std::uint8_t> result;
+
+        if constexpr (isBytePointer<Iterator>)
+        {
+            const auto length = static_cast<std::size_t>(end - begin);
+            result.resize(decodedSize(length));
+            const auto r = decodeBuffer(reinterpret_cast<const char*>(begin), length, result.data(), result.size());
+            if (r.error == Error::invalidCharacter)
+                throw ParseError("Invalid hex digit");
+            else if (r.error != Error::none)
+                throw ParseError("Invalid hex length");
+        }
+        else
+        {
+            std::uint8_t high = 0;
+            bool odd = false;
+            for (auto i = begin; i != end; ++i)
+            {
+                const std::uint8_t value = reverse[static_cast<std::uint8_t>(*i)];
+                if (value > 15) throw ParseError("Invalid hex digit");
+
+                if (odd) result.push_back(static_cast<std::uint8_t>((high << 4) | value));
+                else high = value;
+                odd = !odd;
+            }
+
+            if (odd) throw ParseError("Invalid hex length");
+        }
+
+        return result;
+    }
+
+    template <class T>
+    std::vector<std::uint8_t> decode(const T& s)
+    {
+        if constexpr (IsContiguous<T>::value)
+            return decode(std::data(s), std::data(s) + std::size(s));
+        else
+            return decode(std::begin(s), std::end(s));
+    }
+
+    inline std::vector<std::uint8_t> decode(const char* s)
+    {
+        auto end = s;
+        while (*end) ++end;
+        return decode(s, end);
+    }
+}
+
+#endif // HEX_HPP
@@ -9,6 +9,9 @@
 #include <array>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
 
 namespace sha256
 {
@@ -40,6 +43,13 @@ namespace sha256
         using Block = std::array<std::uint8_t, blockByteCount>;
         using State = std::array<std::uint32_t, digestIntCount>;
 
+        template <class T, class = void>
+        struct IsContiguous: std::false_type {};
+
+        template <class T>
+        struct IsContiguous<T, std::void_t<decltype(std::data(std::declval<const T&>())),
+                                           decltype(std::size(std::declval<const T&>()))>>: std::true_type {};
+
         constexpr std::uint32_t rotateRight(const std::uint32_t value,
                                             const std::uint32_t bits) noexcept
         {
@@ -103,73 +113,141 @@ namespace sha256
         }
     }
 
-    template <class Iterator>
-    std::array<std::uint8_t, digestByteCount> hash(const Iterator begin,
-                                                   const Iterator end) noexcept
+    // incremental hashing, finalizing leaves the hasher untouched so that a common prefix
+    // can be hashed once and the hasher copied for every message that starts with it
+    class Hasher final
     {
-        State state = {
-            0x6A09E667U,
-            0xBB67AE85U,
-            0x3C6EF372U,
-            0xA54FF53AU,
-            0x510E527FU,
-            0x9B05688CU,
-            0x1F83D9ABU,
-            0x5BE0CD19U
-        };
-
-        Block block;
-        std::uint32_t dataSize = 0;
-        for (auto i = begin; i != end; ++i)
+    public:
+        // contiguous input is copied into the block buffer a block at a time
+        template <class T, std::enable_if_t<sizeof(T) == 1>* = nullptr>
+        Hasher& update(const T* input, const std::size_t length) noexcept
         {
-            block[dataSize % blockByteCount] =static_cast<std::uint8_t>(*i);
-            if (++dataSize % blockByteCount == 0)
+            const auto data = reinterpret_cast<const std::uint8_t*>(input);
+            const std::size_t used = static_cast<std::size_t>(size % blockByteCount);
+            size += length;
+
+            std::size_t i = 0;
+            if (used)
+            {
+                i = std::min(blockByteCount - used, length);
+                std::memcpy(block.data() + used, data, i);
+                if (used + i != blockByteCount) return *this;
                 transform(block, state);
+            }
+
+            for (; length - i >= blockByteCount; i += blockByteCount)
+            {
+                std::memcpy(block.data(), data + i, blockByteCount);
+                transform(block, state);
+            }
+
+            std::memcpy(block.data(), data + i, length - i);
+            return *this;
         }
 
-        // pad data left in the buffer
-        const std::uint32_t n = dataSize % blockByteCount;
-        block[n] = 0x80;
-        if (n < blockByteCount - 8)
+        template <class Iterator>
+        Hasher& update(const Iterator begin, const Iterator end) noexcept
         {
-            std::fill(block.begin() + n + 1, block.end() - 8, 0);
+            if constexpr (std::is_pointer_v<Iterator> &&
+                          sizeof(typename std::iterator_traits<Iterator>::value_type) == 1)
+                return update(begin, static_cast<std::size_t>(end - begin));
+            else
+            {
+                for (auto i = begin; i != end; ++i)
+                {
+                    block[size % blockByteCount] = static_cast<std::uint8_t>(*i);
+                    if (++size % blockByteCount == 0)
+                        transform(block, state);
+                }
+                return *this;
+            }
         }
-        else
+
+        template <class T>
+        Hasher& update(const T& v) noexcept
         {
-            std::fill(block.begin() + n + 1, block.end(), 0);
-            transform(block, state);
-            std::fill(block.begin(), block.end() - 8, 0);
+            if constexpr (IsContiguous<T>::value && sizeof(*std::begin(v)) == 1)
+                return update(std::data(v), std::size(v));
+            else
+                return update(std::begin(v), std::end(v));
         }
 
-        // append the size in bits
-        const std::uint64_t totalBits = dataSize * 8;
-        block[63] = static_cast<std::uint8_t>(totalBits);
-        block[62] = static_cast<std::uint8_t>(totalBits >> 8);
-        block[61] = static_cast<std::uint8_t>(totalBits >> 16);
-        block[60] = static_cast<std::uint8_t>(totalBits >> 24);
-        block[59] = static_cast<std::uint8_t>(totalBits >> 32);
-        block[58] = static_cast<std::uint8_t>(totalBits >> 40);
-        block[57] = static_cast<std::uint8_t>(totalBits >> 48);
-        block[56] = static_cast<std::uint8_t>(totalBits >> 56);
-        transform(block, state);
-
-        std::array<std::uint8_t, digestByteCount> result;
-        // reverse all the bytes to big endian
-        for (std::uint32_t i = 0; i < digestIntCount; ++i)
+        std::array<std::uint8_t, digestByteCount> finalize() const noexcept
         {
-            result[i * 4 + 0] = static_cast<std::uint8_t>(state[i] >> 24);
-            result[i * 4 + 1] = static_cast<std::uint8_t>(state[i] >> 16);
-            result[i * 4 + 2] = static_cast<std::uint8_t>(state[i] >> 8);
-            result[i * 4 + 3] = static_cast<std::uint8_t>(state[i]);
+            State finalState = state;
+            Block finalBlock = block;
+
+            // pad data left in the buffer
+            const std::size_t n = size % blockByteCount;
+            finalBlock[n] = 0x80;
+            if (n < blockByteCount - 8)
+            {
+                std::fill(finalBlock.begin() + n + 1, finalBlock.end() - 8, 0);
+            }
+            else
+            {
+                std::fill(finalBlock.begin() + n + 1, finalBlock.end(), 0);
+                transform(finalBlock, finalState);
+                std::fill(finalBlock.begin(), finalBlock.end() - 8, 0);
+            }
+
+            // append the size in bits
+            const std::uint64_t totalBits = size * 8;
+            finalBlock[63] = static_cast<std::uint8_t>(totalBits);
+            finalBlock[62] = static_cast<std::uint8_t>(totalBits >> 8);
+            finalBlock[61] = static_cast<std::uint8_t>(totalBits >> 16);
+            finalBlock[60] = static_cast<std::uint8_t>(totalBits >> 24);
+            finalBlock[59] = static_cast<std::uint8_t>(totalBits >> 32);
+            finalBlock[58] = static_cast<std::uint8_t>(totalBits >> 40);
+            finalBlock[57] = static_cast<std::uint8_t>(totalBits >> 48);
+            finalBlock[56] = static_cast<std::uint8_t>(totalBits >> 56);
+            transform(finalBlock, finalState);
+
+            std::array<std::uint8_t, digestByteCount> result;
+            // reverse all the bytes to big endian
+            for (std::size_t i = 0; i < digestIntCount; ++i)
+            {
+                result[i * 4 + 0] = static_cast<std::uint8_t>(finalState[i] >> 24);
+                result[i * 4 + 1] = static_cast<std::uint8_t>(finalState[i] >> 16);
+                result[i * 4 + 2] = static_cast<std::uint8_t>(finalState[i] >> 8);
+                result[i * 4 + 3] = static_cast<std::uint8_t>(finalState[i]);
+            }
+
+            return result;
         }
 
-        return result;
+    private:
+        State state = {
+            0x6A09E667U,
+            0xBB67AE85U,
+            0x3C6EF372U,
+            0xA54FF53AU,
+            0x510E527FU,
+            0x9B05688CU,
+            0x1F83D9ABU,
+            0x5BE0CD19U
+        };
+        Block block{};
+        std::uint64_t size = 0;
+    };
+
+    template <class T, std::enable_if_t<sizeof(T) == 1>* = nullptr>
+    std::array<std::uint8_t, digestByteCount> hash(const T* input, const std::size_t length) noexcept
+    {
+        return Hasher{}.update(input, length).finalize();
+    }
+
+    template <class Iterator>
+    std::array<std::uint8_t, digestByteCount> hash(const Iterator begin,
+                                                   const Iterator end) noexcept
+    {
+        return Hasher{}.update(begin, end).finalize();
     }
 
     template <class T>
     std::array<std::uint8_t, digestByteCount> hash(const T& v) noexcept
     {
-        return hash(std::begin(v), std::end(v));
+        return Hasher{}.update(v).finalize();
     }
 }
 
@@ -5,8 +5,18 @@
 #ifndef UTF8_HPP
 #define UTF8_HPP
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include "cpu.hpp"
 
 namespace utf8
 {
@@ -17,123 +27,3454 @@ namespace utf8
         explicit ParseError(const char* str): std::logic_error(str) {}
     };
 
+    enum class Error
+    {
+        none,
+        invalidSequence,
+        outputTooSmall
+    };
+
+    // byte order of UTF-16 code units in memory
+    enum class Endianness
+    {
+        little,
+        big,
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        native = big
+#else
+        native = little
+#endif
+    };
+
+    struct Result final
+    {
+        std::size_t size; // number of code points or code units produced
+        Error error;
+        std::size_t position; // offset of the first invalid sequence, or of the end of the input
+    };
+
+    inline namespace detail
+    {
+        template <typename T, typename = void>
+        struct IsContiguous: std::false_type {};
+
+        template <typename T>
+        struct IsContiguous<T, std::void_t<decltype(std::data(std::declval<const T&>())),
+                                           decltype(std::size(std::declval<const T&>()))>>: std::true_type {};
+
+        template <typename Iterator>
+        constexpr bool isBytePointer = std::is_pointer_v<Iterator> &&
+            sizeof(typename std::iterator_traits<Iterator>::value_type) == 1;
+
+        // decodes one code point and advances the iterator past it, rejects truncated sequences,
+        // stray continuation bytes, overlong encodings, surrogates and values above U+10FFFF
+        template <typename Iterator>
+        bool decodeNext(Iterator& i, const Iterator end, char32_t& cp)
+        {
+            const auto lead = static_cast<std::uint8_t>(*i);
+            ++i;
+
+            std::size_t count;
+            char32_t minimum;
+
+            if (lead <= 0x7F)
+            {
+                cp = lead;
+                return true;
+            }
+            else if ((lead >> 5) == 0x06)
+            {
+                cp = lead & 0x1F;
+                count = 1;
+                minimum = 0x80;
+            }
+            else if ((lead >> 4) == 0x0E)
+            {
+                cp = lead & 0x0F;
+                count = 2;
+                minimum = 0x800;
+            }
+            else if ((lead >> 3) == 0x1E)
+            {
+                cp = lead & 0x07;
+                count = 3;
+                minimum = 0x10000;
+            }
+            else
+                return false;
+
+            for (; count; --count, ++i)
+            {
+                if (i == end) return false;
+                const auto b = static_cast<std::uint8_t>(*i);
+                if ((b & 0xC0) != 0x80) return false;
+                cp = (cp << 6) | (b & 0x3F);
+            }
+
+            return cp >= minimum && cp <= 0x10FFFF && (cp < 0xD800 || cp > 0xDFFF);
+        }
+
+        constexpr bool isValidCodePoint(const char32_t cp) noexcept
+        {
+            return cp <= 0x10FFFF && (cp < 0xD800 || cp > 0xDFFF);
+        }
+
+        constexpr std::size_t getEncodedLength(const char32_t cp) noexcept
+        {
+            return cp <= 0x7F ? 1 : cp <= 0x7FF ? 2 : cp <= 0xFFFF ? 3 : 4;
+        }
+
+        template <Endianness endianness>
+        constexpr char16_t convert(const char16_t unit) noexcept
+        {
+            return endianness == Endianness::native ? unit : static_cast<char16_t>((unit << 8) | (unit >> 8));
+        }
+
+        // decodes one code point from UTF-16 and advances the iterator past it, rejects unpaired surrogates
+        template <Endianness endianness, typename Iterator>
+        bool decodeNextUtf16(Iterator& i, const Iterator end, char32_t& cp)
+        {
+            const char16_t unit = convert<endianness>(static_cast<char16_t>(*i));
+            ++i;
+
+            if ((unit & 0xF800) != 0xD800)
+            {
+                cp = unit;
+                return true;
+            }
+
+            if (unit > 0xDBFF || i == end) return false;
+            const char16_t next = convert<endianness>(static_cast<char16_t>(*i));
+            if ((next & 0xFC00) != 0xDC00) return false;
+            ++i;
+
+            cp = 0x10000 + ((static_cast<char32_t>(unit) - 0xD800) << 10) + (next - 0xDC00);
+            return true;
+        }
+
+        // writes one or two code units, returns their number
+        template <Endianness endianness>
+        std::size_t encodeUtf16(const char32_t cp, char16_t* output) noexcept
+        {
+            if (cp <= 0xFFFF)
+            {
+                output[0] = convert<endianness>(static_cast<char16_t>(cp));
+                return 1;
+            }
+
+            output[0] = convert<endianness>(static_cast<char16_t>(0xD800 + ((cp - 0x10000) >> 10)));
+            output[1] = convert<endianness>(static_cast<char16_t>(0xDC00 + ((cp - 0x10000) & 0x3FF)));
+            return 2;
+        }
+
+        // writes the UTF-8 sequence of a code point, returns its length
+        inline std::size_t encodeUtf8(const char32_t cp, char* output) noexcept
+        {
+            if (cp <= 0x7F)
+            {
+                output[0] = static_cast<char>(cp);
+                return 1;
+            }
+            else if (cp <= 0x7FF)
+            {
+                output[0] = static_cast<char>(0xC0 | (cp >> 6));
+                output[1] = static_cast<char>(0x80 | (cp & 0x3F));
+                return 2;
+            }
+            else if (cp <= 0xFFFF)
+            {
+                output[0] = static_cast<char>(0xE0 | (cp >> 12));
+                output[1] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                output[2] = static_cast<char>(0x80 | (cp & 0x3F));
+                return 3;
+            }
+            else
+            {
+                output[0] = static_cast<char>(0xF0 | (cp >> 18));
+                output[1] = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+                output[2] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                output[3] = static_cast<char>(0x80 | (cp & 0x3F));
+                return 4;
+            }
+        }
+
+        // decodes a multi-byte sequence that is known to be valid
+        inline char32_t decodeValid(const std::uint8_t* input, std::size_t& i) noexcept
+        {
+            const std::uint8_t lead = input[i];
+            char32_t cp;
+
+            if (lead < 0xE0)
+            {
+                cp = (static_cast<char32_t>(lead & 0x1F) << 6) | (input[i + 1] & 0x3F);
+                i += 2;
+            }
+            else if (lead < 0xF0)
+            {
+                cp = (static_cast<char32_t>(lead & 0x0F) << 12) |
+                    (static_cast<char32_t>(input[i + 1] & 0x3F) << 6) | (input[i + 2] & 0x3F);
+                i += 3;
+            }
+            else
+            {
+                cp = (static_cast<char32_t>(lead & 0x07) << 18) | (static_cast<char32_t>(input[i + 1] & 0x3F) << 12) |
+                    (static_cast<char32_t>(input[i + 2] & 0x3F) << 6) | (input[i + 3] & 0x3F);
+                i += 4;
+            }
+
+            return cp;
+        }
+
+#ifdef CPU_X86
+        // error classes of two-byte patterns, a pair is invalid when a bit is set in all three lookups
+        // (Keiser and Lemire, "Validating UTF-8 In Less Than One Instruction Per Byte")
+        constexpr char tooShort = 1 << 0; // lead byte not followed by a continuation byte
+        constexpr char tooLong = 1 << 1; // ASCII followed by a continuation byte
+        constexpr char overlong3 = 1 << 2;
+        constexpr char tooLarge = 1 << 3;
+        constexpr char surrogate = 1 << 4;
+        constexpr char overlong2 = 1 << 5;
+        constexpr char tooLarge1000 = 1 << 6;
+        constexpr char overlong4 = 1 << 6;
+        constexpr char twoContinuations = static_cast<char>(1 << 7);
+        constexpr char carry = tooShort | tooLong | twoContinuations;
+
+        struct ValidationState final
+        {
+            __m128i previous;
+            __m128i incomplete;
+            __m128i error;
+        };
+
+        CPU_TARGET("ssse3") inline __m128i checkSsse3(const __m128i input, const __m128i previous) noexcept
+        {
+            const __m128i mask = _mm_set1_epi8(0x0F);
+            const __m128i previous1 = _mm_alignr_epi8(input, previous, 15);
+
+            const __m128i byte1High = _mm_shuffle_epi8(_mm_setr_epi8(tooLong, tooLong, tooLong, tooLong,
+                                                                     tooLong, tooLong, tooLong, tooLong,
+                                                                     twoContinuations, twoContinuations,
+                                                                     twoContinuations, twoContinuations,
+                                                                     tooShort | overlong2,
+                                                                     tooShort,
+                                                                     tooShort | overlong3 | surrogate,
+                                                                     tooShort | tooLarge | tooLarge1000 | overlong4),
+                                                       _mm_and_si128(_mm_srli_epi16(previous1, 4), mask));
+
+            const __m128i byte1Low = _mm_shuffle_epi8(_mm_setr_epi8(carry | overlong3 | overlong2 | overlong4,
+                                                                    carry | overlong2,
+                                                                    carry,
+                                                                    carry,
+                                                                    carry | tooLarge,
+                                                                    carry | tooLarge | tooLarge1000,
+                                                                    carry | tooLarge | tooLarge1000,
+                                                                    carry | tooLarge | tooLarge1000,
+                                                                    carry | tooLarge | tooLarge1000,
+                                                                    carry | tooLarge | tooLarge1000,
+                                                                    carry | tooLarge | tooLarge1000,
+                                                                    carry | tooLarge | tooLarge1000,
+                                                                    carry | tooLarge | tooLarge1000,
+                                                                    carry | tooLarge | tooLarge1000 | surrogate,
+                                                                    carry | tooLarge | tooLarge1000,
+                                                                    carry | tooLarge | tooLarge1000),
+                                                      _mm_and_si128(previous1, mask));
+
+            const __m128i byte2High = _mm_shuffle_epi8(_mm_setr_epi8(tooShort, tooShort, tooShort, tooShort,
+                                                                     tooShort, tooShort, tooShort, tooShort,
+                                                                     tooLong | overlong2 | twoContinuations | overlong3 | tooLarge1000 | overlong4,
+                                                                     tooLong | overlong2 | twoContinuations | overlong3 | tooLarge,
+                                                                     tooLong | overlong2 | twoContinuations | surrogate | tooLarge,
+                                                                     tooLong | overlong2 | twoContinuations | surrogate | tooLarge,
+                                                                     tooShort, tooShort, tooShort, tooShort),
+                                                       _mm_and_si128(_mm_srli_epi16(input, 4), mask));
+
+            const __m128i special = _mm_and_si128(_mm_and_si128(byte1High, byte1Low), byte2High);
+
+            // the third and fourth bytes of a sequence have to be continuation bytes
+            const __m128i previous2 = _mm_alignr_epi8(input, previous, 14);
+            const __m128i previous3 = _mm_alignr_epi8(input, previous, 13);
+            const __m128i mustContinue = _mm_or_si128(_mm_subs_epu8(previous2, _mm_set1_epi8(static_cast<char>(0xE0 - 0x80))),
+                                                      _mm_subs_epu8(previous3, _mm_set1_epi8(static_cast<char>(0xF0 - 0x80))));
+
+            return _mm_xor_si128(_mm_and_si128(mustContinue, _mm_set1_epi8(static_cast<char>(0x80))), special);
+        }
+
+        CPU_TARGET("ssse3") inline void stepSsse3(ValidationState& state, const __m128i input) noexcept
+        {
+            if (_mm_movemask_epi8(input) == 0)
+                state.error = _mm_or_si128(state.error, state.incomplete);
+            else
+            {
+                state.error = _mm_or_si128(state.error, checkSsse3(input, state.previous));
+                // a sequence that starts in the last three bytes continues in the next block
+                state.incomplete = _mm_subs_epu8(input, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                                      static_cast<char>(0xF0 - 1),
+                                                                      static_cast<char>(0xE0 - 1),
+                                                                      static_cast<char>(0xC0 - 1)));
+            }
+            state.previous = input;
+        }
+
+        CPU_TARGET("ssse3") inline bool hasErrorSsse3(const ValidationState& state) noexcept
+        {
+            return _mm_movemask_epi8(_mm_cmpeq_epi8(state.error, _mm_setzero_si128())) != 0xFFFF;
+        }
+
+        // on failure block is set to the start of the block where the error was found
+        CPU_TARGET("ssse3") inline bool validateSsse3(const std::uint8_t* input, const std::size_t length,
+                                                      std::size_t& block) noexcept
+        {
+            ValidationState state = {_mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128()};
+
+            std::size_t i = 0;
+            for (; length - i >= 16; i += 16)
+            {
+                stepSsse3(state, _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i)));
+                if (hasErrorSsse3(state))
+                {
+                    block = i;
+                    return false;
+                }
+            }
+
+            // the zero padding also flags sequences truncated by the end of the input
+            std::uint8_t tail[16] = {};
+            std::memcpy(tail, input + i, length - i);
+            stepSsse3(state, _mm_loadu_si128(reinterpret_cast<const __m128i*>(tail)));
+
+            block = i;
+            return !hasErrorSsse3(state);
+        }
+
+        // counts the bytes that are not continuation bytes, or only the lead bytes of four-byte sequences
+        template <bool fourByte>
+        CPU_TARGET("ssse3") inline std::size_t countSsse3(const std::uint8_t* input, const std::size_t length,
+                                                          std::size_t& count) noexcept
+        {
+            std::size_t i = 0;
+            while (length - i >= 16)
+            {
+                // byte counters overflow after 255 steps
+                __m128i counters = _mm_setzero_si128();
+                for (std::size_t step = 0; step < 255 && length - i >= 16; ++step, i += 16)
+                {
+                    const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+                    counters = _mm_sub_epi8(counters, fourByte ?
+                        _mm_cmpgt_epi8(_mm_xor_si128(in, _mm_set1_epi8(static_cast<char>(0x80))), _mm_set1_epi8(0xEF - 0x80)) :
+                        _mm_cmpgt_epi8(in, _mm_set1_epi8(static_cast<char>(0xBF))));
+                }
+
+                const __m128i sums = _mm_sad_epu8(counters, _mm_setzero_si128());
+                count += static_cast<std::size_t>(_mm_cvtsi128_si32(sums)) +
+                    static_cast<std::size_t>(_mm_cvtsi128_si32(_mm_srli_si128(sums, 8)));
+            }
+            return i;
+        }
+
+        struct ValidationStateAvx2 final
+        {
+            __m256i previous;
+            __m256i incomplete;
+            __m256i error;
+        };
+
+        CPU_TARGET("avx2") inline __m256i checkAvx2(const __m256i input, const __m256i previous) noexcept
+        {
+            const __m256i mask = _mm256_set1_epi8(0x0F);
+            const __m256i shifted = _mm256_permute2x128_si256(previous, input, 0x21);
+            const __m256i previous1 = _mm256_alignr_epi8(input, shifted, 15);
+
+            const __m256i byte1High = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_setr_epi8(tooLong, tooLong, tooLong, tooLong,
+                                                                                                    tooLong, tooLong, tooLong, tooLong,
+                                                                                                    twoContinuations, twoContinuations,
+                                                                                                    twoContinuations, twoContinuations,
+                                                                                                    tooShort | overlong2,
+                                                                                                    tooShort,
+                                                                                                    tooShort | overlong3 | surrogate,
+                                                                                                    tooShort | tooLarge | tooLarge1000 | overlong4)),
+                                                          _mm256_and_si256(_mm256_srli_epi16(previous1, 4), mask));
+
+            const __m256i byte1Low = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_setr_epi8(carry | overlong3 | overlong2 | overlong4,
+                                                                                                   carry | overlong2,
+                                                                                                   carry,
+                                                                                                   carry,
+                                                                                                   carry | tooLarge,
+                                                                                                   carry | tooLarge | tooLarge1000,
+                                                                                                   carry | tooLarge | tooLarge1000,
+                                                                                                   carry | tooLarge | tooLarge1000,
+                                                                                                   carry | tooLarge | tooLarge1000,
+                                                                                                   carry | tooLarge | tooLarge1000,
+                                                                                                   carry | tooLarge | tooLarge1000,
+                                                                                                   carry | tooLarge | tooLarge1000,
+                                                                                                   carry | tooLarge | tooLarge1000,
+                                                                                                   carry | tooLarge | tooLarge1000 | surrogate,
+                                                                                                   carry | tooLarge | tooLarge1000,
+                                                                                                   carry | tooLarge | tooLarge1000)),
+                                                         _mm256_and_si256(previous1, mask));
+
+            const __m256i byte2High = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_setr_epi8(tooShort, tooShort, tooShort, tooShort,
+                                                                                                    tooShort, tooShort, tooShort, tooShort,
+                                                                                                    tooLong | overlong2 | twoContinuations | overlong3 | tooLarge1000 | overlong4,
+                                                                                                    tooLong | overlong2 | twoContinuations | overlong3 | tooLarge,
+                                                                                                    tooLong | overlong2 | twoContinuations | surrogate | tooLarge,
+                                                                                                    tooLong | overlong2 | twoContinuations | surrogate | tooLarge,
+                                                                                                    tooShort, tooShort, tooShort, tooShort)),
+                                                          _mm256_and_si256(_mm256_srli_epi16(input, 4), mask));
+
+            const __m256i special = _mm256_and_si256(_mm256_and_si256(byte1High, byte1Low), byte2High);
+
+            const __m256i previous2 = _mm256_alignr_epi8(input, shifted, 14);
+            const __m256i previous3 = _mm256_alignr_epi8(input, shifted, 13);
+            const __m256i mustContinue = _mm256_or_si256(_mm256_subs_epu8(previous2, _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80))),
+                                                         _mm256_subs_epu8(previous3, _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80))));
+
+            return _mm256_xor_si256(_mm256_and_si256(mustContinue, _mm256_set1_epi8(static_cast<char>(0x80))), special);
+        }
+
+        CPU_TARGET("avx2") inline void stepAvx2(ValidationStateAvx2& state, const __m256i input) noexcept
+        {
+            if (_mm256_movemask_epi8(input) == 0)
+                state.error = _mm256_or_si256(state.error, state.incomplete);
+            else
+            {
+                state.error = _mm256_or_si256(state.error, checkAvx2(input, state.previous));
+                state.incomplete = _mm256_subs_epu8(input, _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                                            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                                            static_cast<char>(0xF0 - 1),
+                                                                            static_cast<char>(0xE0 - 1),
+                                                                            static_cast<char>(0xC0 - 1)));
+            }
+            state.previous = input;
+        }
+
+        CPU_TARGET("avx2") inline bool hasErrorAvx2(const ValidationStateAvx2& state) noexcept
+        {
+            return !_mm256_testz_si256(state.error, state.error);
+        }
+
+        CPU_TARGET("avx2") inline bool validateAvx2(const std::uint8_t* input, const std::size_t length,
+                                                    std::size_t& block) noexcept
+        {
+            ValidationStateAvx2 state = {_mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256()};
+
+            std::size_t i = 0;
+            for (; length - i >= 32; i += 32)
+            {
+                stepAvx2(state, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i)));
+                if (hasErrorAvx2(state))
+                {
+                    block = i;
+                    return false;
+                }
+            }
+
+            std::uint8_t tail[32] = {};
+            std::memcpy(tail, input + i, length - i);
+            stepAvx2(state, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tail)));
+
+            block = i;
+            return !hasErrorAvx2(state);
+        }
+
+        template <bool fourByte>
+        CPU_TARGET("avx2") inline std::size_t countAvx2(const std::uint8_t* input, const std::size_t length,
+                                                        std::size_t& count) noexcept
+        {
+            std::size_t i = 0;
+            while (length - i >= 32)
+            {
+                __m256i counters = _mm256_setzero_si256();
+                for (std::size_t step = 0; step < 255 && length - i >= 32; ++step, i += 32)
+                {
+                    const __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+                    counters = _mm256_sub_epi8(counters, fourByte ?
+                        _mm256_cmpgt_epi8(_mm256_xor_si256(in, _mm256_set1_epi8(static_cast<char>(0x80))), _mm256_set1_epi8(0xEF - 0x80)) :
+                        _mm256_cmpgt_epi8(in, _mm256_set1_epi8(static_cast<char>(0xBF))));
+                }
+
+                const __m256i sums = _mm256_sad_epu8(counters, _mm256_setzero_si256());
+                const __m128i sum = _mm_add_epi64(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1));
+                count += static_cast<std::size_t>(_mm_cvtsi128_si32(sum)) +
+                    static_cast<std::size_t>(_mm_cvtsi128_si32(_mm_srli_si128(sum, 8)));
+            }
+            return i + countSsse3<fourByte>(input + i, length - i, count);
+        }
+
+        // 16 ASCII characters per step, stops at the first block with a non-ASCII byte
+        CPU_TARGET("ssse3") inline std::size_t widenSsse3(const std::uint8_t* input, const std::size_t length,
+                                                          char32_t* output) noexcept
+        {
+            const __m128i zero = _mm_setzero_si128();
+
+            std::size_t i = 0;
+            for (; length - i >= 16; i += 16)
+            {
+                const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+                if (_mm_movemask_epi8(in)) break;
+
+                const __m128i low = _mm_unpacklo_epi8(in, zero);
+                const __m128i high = _mm_unpackhi_epi8(in, zero);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_unpacklo_epi16(low, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i + 4), _mm_unpackhi_epi16(low, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i + 8), _mm_unpacklo_epi16(high, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i + 12), _mm_unpackhi_epi16(high, zero));
+            }
+            return i;
+        }
+
+        // 32 ASCII characters per step
+        CPU_TARGET("avx2") inline std::size_t widenAvx2(const std::uint8_t* input, const std::size_t length,
+                                                        char32_t* output) noexcept
+        {
+            std::size_t i = 0;
+            for (; length - i >= 32; i += 32)
+            {
+                const __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+                if (_mm256_movemask_epi8(in)) break;
+
+                const __m128i low = _mm256_castsi256_si128(in);
+                const __m128i high = _mm256_extracti128_si256(in, 1);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), _mm256_cvtepu8_epi32(low));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i + 8), _mm256_cvtepu8_epi32(_mm_srli_si128(low, 8)));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i + 16), _mm256_cvtepu8_epi32(high));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i + 24), _mm256_cvtepu8_epi32(_mm_srli_si128(high, 8)));
+            }
+            return i + widenSsse3(input + i, length - i, output + i);
+        }
+
+        // the kernels below run on little-endian x86, big-endian code units are swapped in registers
+        template <Endianness endianness>
+        CPU_TARGET("ssse3") inline __m128i swapSsse3(const __m128i units) noexcept
+        {
+            return endianness == Endianness::big ? _mm_or_si128(_mm_slli_epi16(units, 8), _mm_srli_epi16(units, 8)) : units;
+        }
+
+        template <Endianness endianness>
+        CPU_TARGET("avx2") inline __m256i swapAvx2(const __m256i units) noexcept
+        {
+            return endianness == Endianness::big ? _mm256_or_si256(_mm256_slli_epi16(units, 8), _mm256_srli_epi16(units, 8)) : units;
+        }
+
+        // 16 ASCII characters per step into UTF-16 code units
+        template <Endianness endianness>
+        CPU_TARGET("ssse3") inline std::size_t widenUtf16Ssse3(const std::uint8_t* input, const std::size_t length,
+                                                               char16_t* output) noexcept
+        {
+            const __m128i zero = _mm_setzero_si128();
+
+            std::size_t i = 0;
+            for (; length - i >= 16; i += 16)
+            {
+                const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+                if (_mm_movemask_epi8(in)) break;
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i),
+                                 endianness == Endianness::big ? _mm_unpacklo_epi8(zero, in) : _mm_unpacklo_epi8(in, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i + 8),
+                                 endianness == Endianness::big ? _mm_unpackhi_epi8(zero, in) : _mm_unpackhi_epi8(in, zero));
+            }
+            return i;
+        }
+
+        // 32 ASCII characters per step
+        template <Endianness endianness>
+        CPU_TARGET("avx2") inline std::size_t widenUtf16Avx2(const std::uint8_t* input, const std::size_t length,
+                                                             char16_t* output) noexcept
+        {
+            std::size_t i = 0;
+            for (; length - i >= 32; i += 32)
+            {
+                const __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+                if (_mm256_movemask_epi8(in)) break;
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i),
+                                    swapAvx2<endianness>(_mm256_cvtepu8_epi16(_mm256_castsi256_si128(in))));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i + 16),
+                                    swapAvx2<endianness>(_mm256_cvtepu8_epi16(_mm256_extracti128_si256(in, 1))));
+            }
+            return i + widenUtf16Ssse3<endianness>(input + i, length - i, output + i);
+        }
+
+        // 16 ASCII code units per step into bytes
+        template <Endianness endianness>
+        CPU_TARGET("ssse3") inline std::size_t narrowUtf16Ssse3(const char16_t* input, const std::size_t length,
+                                                                char* output) noexcept
+        {
+            const __m128i mask = _mm_set1_epi16(static_cast<short>(0xFF80));
+            const __m128i zero = _mm_setzero_si128();
+
+            std::size_t i = 0;
+            for (; length - i >= 16; i += 16)
+            {
+                const __m128i low = swapSsse3<endianness>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i)));
+                const __m128i high = swapSsse3<endianness>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 8)));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(_mm_or_si128(low, high), mask), zero)) != 0xFFFF) break;
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_packus_epi16(low, high));
+            }
+            return i;
+        }
+
+        // 32 ASCII code units per step
+        template <Endianness endianness>
+        CPU_TARGET("avx2") inline std::size_t narrowUtf16Avx2(const char16_t* input, const std::size_t length,
+                                                              char* output) noexcept
+        {
+            const __m256i mask = _mm256_set1_epi16(static_cast<short>(0xFF80));
+
+            std::size_t i = 0;
+            for (; length - i >= 32; i += 32)
+            {
+                const __m256i low = swapAvx2<endianness>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i)));
+                const __m256i high = swapAvx2<endianness>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i + 16)));
+                if (!_mm256_testz_si256(_mm256_or_si256(low, high), mask)) break;
+
+                // packing works per 128-bit lane, the permutation restores the order
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i),
+                                    _mm256_permute4x64_epi64(_mm256_packus_epi16(low, high), 0xD8));
+            }
+            return i + narrowUtf16Ssse3<endianness>(input + i, length - i, output + i);
+        }
+
+        // adds up the UTF-8 length of 8 code units per step, stops at the first block with a surrogate
+        template <Endianness endianness>
+        CPU_TARGET("ssse3") inline std::size_t utf8LengthSsse3(const char16_t* input, const std::size_t length,
+                                                               std::size_t& size) noexcept
+        {
+            const __m128i surrogateMask = _mm_set1_epi16(static_cast<short>(0xF800));
+            const __m128i surrogate = _mm_set1_epi16(static_cast<short>(0xD800));
+            // signed comparisons of biased values stand in for the missing unsigned ones
+            const __m128i bias = _mm_set1_epi16(-0x8000);
+            const __m128i twoBytes = _mm_set1_epi16(0x7F - 0x8000);
+            const __m128i threeBytes = _mm_set1_epi16(0x7FF - 0x8000);
+
+            std::size_t i = 0;
+            bool surrogates = false;
+            while (!surrogates && length - i >= 8)
+            {
+                // each 16-bit counter grows by at most 2 per step
+                __m128i counters = _mm_setzero_si128();
+                std::size_t steps = 0;
+                for (; steps < 8192 && length - i >= 8; ++steps, i += 8)
+                {
+                    const __m128i units = swapSsse3<endianness>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i)));
+                    if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(units, surrogateMask), surrogate)))
+                    {
+                        surrogates = true;
+                        break;
+                    }
+
+                    const __m128i biased = _mm_xor_si128(units, bias);
+                    counters = _mm_sub_epi16(_mm_sub_epi16(counters, _mm_cmpgt_epi16(biased, twoBytes)),
+                                             _mm_cmpgt_epi16(biased, threeBytes));
+                }
+
+                __m128i sums = _mm_madd_epi16(counters, _mm_set1_epi16(1));
+                sums = _mm_add_epi32(sums, _mm_srli_si128(sums, 8));
+                sums = _mm_add_epi32(sums, _mm_srli_si128(sums, 4));
+                size += steps * 8 + static_cast<std::size_t>(_mm_cvtsi128_si32(sums));
+            }
+            return i;
+        }
+
+        // 16 code units per step
+        template <Endianness endianness>
+        CPU_TARGET("avx2") inline std::size_t utf8LengthAvx2(const char16_t* input, const std::size_t length,
+                                                             std::size_t& size) noexcept
+        {
+            const __m256i surrogateMask = _mm256_set1_epi16(static_cast<short>(0xF800));
+            const __m256i surrogate = _mm256_set1_epi16(static_cast<short>(0xD800));
+            const __m256i bias = _mm256_set1_epi16(-0x8000);
+            const __m256i twoBytes = _mm256_set1_epi16(0x7F - 0x8000);
+            const __m256i threeBytes = _mm256_set1_epi16(0x7FF - 0x8000);
+
+            std::size_t i = 0;
+            bool surrogates = false;
+            while (!surrogates && length - i >= 16)
+            {
+                __m256i counters = _mm256_setzero_si256();
+                std::size_t steps = 0;
+                for (; steps < 8192 && length - i >= 16; ++steps, i += 16)
+                {
+                    const __m256i units = swapAvx2<endianness>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i)));
+                    if (_mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_and_si256(units, surrogateMask), surrogate)))
+                    {
+                        surrogates = true;
+                        break;
+                    }
+
+                    const __m256i biased = _mm256_xor_si256(units, bias);
+                    counters = _mm256_sub_epi16(_mm256_sub_epi16(counters, _mm256_cmpgt_epi16(biased, twoBytes)),
+                                                _mm256_cmpgt_epi16(biased, threeBytes));
+                }
+
+                const __m256i wide = _mm256_madd_epi16(counters, _mm256_set1_epi16(1));
+                __m128i sums = _mm_add_epi32(_mm256_castsi256_si128(wide), _mm256_extracti128_si256(wide, 1));
+                sums = _mm_add_epi32(sums, _mm_srli_si128(sums, 8));
+                sums = _mm_add_epi32(sums, _mm_srli_si128(sums, 4));
+                size += steps * 16 + static_cast<std::size_t>(_mm_cvtsi128_si32(sums));
+            }
+            return i + utf8LengthSsse3<endianness>(input + i, length - i, size);
+        }
+
+        // 16 ASCII code points per step into bytes
+        CPU_TARGET("ssse3") inline std::size_t narrowUtf32Ssse3(const char32_t* input, const std::size_t length,
+                                                                char* output) noexcept
+        {
+            const __m128i mask = _mm_set1_epi32(static_cast<int>(0xFFFFFF80));
+            const __m128i zero = _mm_setzero_si128();
+
+            std::size_t i = 0;
+            for (; length - i >= 16; i += 16)
+            {
+                const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+                const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 4));
+                const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 8));
+                const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 12));
+                const __m128i all = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(all, mask), zero)) != 0xFFFF) break;
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i),
+                                 _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+            }
+            return i;
+        }
+
+        // 32 ASCII code points per step
+        CPU_TARGET("avx2") inline std::size_t narrowUtf32Avx2(const char32_t* input, const std::size_t length,
+                                                              char* output) noexcept
+        {
+            const __m256i mask = _mm256_set1_epi32(static_cast<int>(0xFFFFFF80));
+            const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+            std::size_t i = 0;
+            for (; length - i >= 32; i += 32)
+            {
+                const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+                const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i + 8));
+                const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i + 16));
+                const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i + 24));
+                if (!_mm256_testz_si256(_mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d)), mask)) break;
+
+                // packing works per 128-bit lane, the permutation restores the order of the four-byte groups
+                const __m256i packed = _mm256_packus_epi16(_mm256_packs_epi32(a, b), _mm256_packs_epi32(c, d));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), _mm256_permutevar8x32_epi32(packed, order));
+            }
+            return i + narrowUtf32Ssse3(input + i, length - i, output + i);
+        }
+
+        // adds up the UTF-8 length of 4 code points per step, stops at the first block with an invalid code point
+        CPU_TARGET("ssse3") inline std::size_t utf8LengthUtf32Ssse3(const char32_t* input, const std::size_t length,
+                                                                     std::size_t& size) noexcept
+        {
+            const __m128i surrogateMask = _mm_set1_epi32(static_cast<int>(0xFFFFF800));
+            const __m128i surrogate = _mm_set1_epi32(0xD800);
+            const __m128i maximumPlane = _mm_set1_epi32(0x10);
+            const __m128i twoBytes = _mm_set1_epi32(0x7F);
+            const __m128i threeBytes = _mm_set1_epi32(0x7FF);
+            const __m128i fourBytes = _mm_set1_epi32(0xFFFF);
+
+            std::size_t i = 0;
+            bool invalid = false;
+            while (!invalid && length - i >= 4)
+            {
+                // each 32-bit counter grows by at most 3 per step
+                __m128i counters = _mm_setzero_si128();
+                std::size_t steps = 0;
+                for (; steps < 65536 && length - i >= 4; ++steps, i += 4)
+                {
+                    const __m128i cp = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+                    // the plane is never negative, so a signed comparison rejects everything above U+10FFFF
+                    const __m128i errors = _mm_or_si128(_mm_cmpgt_epi32(_mm_srli_epi32(cp, 16), maximumPlane),
+                                                        _mm_cmpeq_epi32(_mm_and_si128(cp, surrogateMask), surrogate));
+                    if (_mm_movemask_epi8(errors))
+                    {
+                        invalid = true;
+                        break;
+                    }
+
+                    counters = _mm_sub_epi32(counters, _mm_cmpgt_epi32(cp, twoBytes));
+                    counters = _mm_sub_epi32(counters, _mm_cmpgt_epi32(cp, threeBytes));
+                    counters = _mm_sub_epi32(counters, _mm_cmpgt_epi32(cp, fourBytes));
+                }
+
+                counters = _mm_add_epi32(counters, _mm_srli_si128(counters, 8));
+                counters = _mm_add_epi32(counters, _mm_srli_si128(counters, 4));
+                size += steps * 4 + static_cast<std::size_t>(_mm_cvtsi128_si32(counters));
+            }
+            return i;
+        }
+
+        // 8 code points per step
+        CPU_TARGET("avx2") inline std::size_t utf8LengthUtf32Avx2(const char32_t* input, const std::size_t length,
+                                                                   std::size_t& size) noexcept
+        {
+            const __m256i surrogateMask = _mm256_set1_epi32(static_cast<int>(0xFFFFF800));
+            const __m256i surrogate = _mm256_set1_epi32(0xD800);
+            const __m256i maximumPlane = _mm256_set1_epi32(0x10);
+            const __m256i twoBytes = _mm256_set1_epi32(0x7F);
+            const __m256i threeBytes = _mm256_set1_epi32(0x7FF);
+            const __m256i fourBytes = _mm256_set1_epi32(0xFFFF);
+
+            std::size_t i = 0;
+            bool invalid = false;
+            while (!invalid && length - i >= 8)
+            {
+                __m256i counters = _mm256_setzero_si256();
+                std::size_t steps = 0;
+                for (; steps < 65536 && length - i >= 8; ++steps, i += 8)
+                {
+                    const __m256i cp = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+                    const __m256i errors = _mm256_or_si256(_mm256_cmpgt_epi32(_mm256_srli_epi32(cp, 16), maximumPlane),
+                                                           _mm256_cmpeq_epi32(_mm256_and_si256(cp, surrogateMask), surrogate));
+                    if (!_mm256_testz_si256(errors, errors))
+                    {
+                        invalid = true;
+                        break;
+                    }
+
+                    counters = _mm256_sub_epi32(counters, _mm256_cmpgt_epi32(cp, twoBytes));
+                    counters = _mm256_sub_epi32(counters, _mm256_cmpgt_epi32(cp, threeBytes));
+                    counters = _mm256_sub_epi32(counters, _mm256_cmpgt_epi32(cp, fourBytes));
+                }
+
+                __m128i sums = _mm_add_epi32(_mm256_castsi256_si128(counters), _mm256_extracti128_si256(counters, 1));
+                sums = _mm_add_epi32(sums, _mm_srli_si128(sums, 8));
+                sums = _mm_add_epi32(sums, _mm_srli_si128(sums, 4));
+                size += steps * 8 + static_cast<std::size_t>(_mm_cvtsi128_si32(sums));
+            }
+            return i + utf8LengthUtf32Ssse3(input + i, length - i, size);
+        }
+#endif
+
+        // finds the first invalid sequence, returns the input length if there is none
+        inline std::size_t findError(const std::uint8_t* input, const std::size_t length) noexcept
+        {
+            std::size_t i = 0;
+#ifdef CPU_X86
+            static const auto validate = cpu::select<decltype(&validateSsse3)>({
+                {cpu::Feature::avx2, validateAvx2},
+                {cpu::Feature::ssse3, validateSsse3}
+            }, nullptr);
+            if (validate)
+            {
+                if (validate(input, length, i))
+                    return length;
+
+                // the offending sequence may have started in the last three bytes of the previous block,
+                // anything before that is complete and valid
+                if (i)
+                {
+                    const std::size_t block = i;
+                    i -= 3;
+                    while (i != block && (input[i] & 0xC0) == 0x80) ++i;
+                }
+            }
+#endif
+            const std::uint8_t* end = input + length;
+            for (auto p = input + i; p != end;)
+            {
+                const auto start = p;
+                char32_t cp;
+                if (!decodeNext(p, end, cp)) return static_cast<std::size_t>(start - input);
+            }
+            return length;
+        }
+
+        inline bool isValid(const std::uint8_t* input, const std::size_t length) noexcept
+        {
+            return findError(input, length) == length;
+        }
+
+        template <bool fourByte = false>
+        std::size_t countLeadBytes(const std::uint8_t* input, const std::size_t length) noexcept
+        {
+            std::size_t count = 0;
+            std::size_t i = 0;
+#ifdef CPU_X86
+            static const auto countBlocks = cpu::select<decltype(&countSsse3<fourByte>)>({
+                {cpu::Feature::avx2, countAvx2<fourByte>},
+                {cpu::Feature::ssse3, countSsse3<fourByte>}
+            }, nullptr);
+            if (countBlocks) i = countBlocks(input, length, count);
+#endif
+            for (; i != length; ++i)
+                if (fourByte ? input[i] >= 0xF0 : (input[i] & 0xC0) != 0x80) ++count;
+            return count;
+        }
+
+        // widens whole blocks of ASCII characters, returns the number of bytes consumed
+        inline std::size_t widenAscii(const std::uint8_t* input, const std::size_t length, char32_t* output) noexcept
+        {
+#ifdef CPU_X86
+            static const auto widen = cpu::select<decltype(&widenSsse3)>({
+                {cpu::Feature::avx2, widenAvx2},
+                {cpu::Feature::ssse3, widenSsse3}
+            }, nullptr);
+            return widen ? widen(input, length, output) : 0;
+#else
+            (void)input;
+            (void)length;
+            (void)output;
+            return 0;
+#endif
+        }
+
+        // input must be valid UTF-8, output must hold length code points
+        inline std::size_t decodeValidBuffer(const std::uint8_t* input, const std::size_t length,
+                                             char32_t* output) noexcept
+        {
+            std::size_t i = 0;
+            std::size_t o = 0;
+
+            while (i != length)
+            {
+                if (input[i] <= 0x7F)
+                {
+                    const std::size_t ascii = widenAscii(input + i, length - i, output + o);
+                    i += ascii;
+                    o += ascii;
+                    for (; i != length && input[i] <= 0x7F; ++i) output[o++] = input[i];
+                }
+                else
+                    output[o++] = decodeValid(input, i);
+            }
+
+            return o;
+        }
+
+        template <Endianness endianness>
+        std::size_t widenUtf16(const std::uint8_t* input, const std::size_t length, char16_t* output) noexcept
+        {
+#ifdef CPU_X86
+            static const auto widen = cpu::select<decltype(&widenUtf16Ssse3<endianness>)>({
+                {cpu::Feature::avx2, widenUtf16Avx2<endianness>},
+                {cpu::Feature::ssse3, widenUtf16Ssse3<endianness>}
+            }, nullptr);
+            return widen ? widen(input, length, output) : 0;
+#else
+            (void)input;
+            (void)length;
+            (void)output;
+            return 0;
+#endif
+        }
+
+        template <Endianness endianness>
+        std::size_t narrowUtf16(const char16_t* input, const std::size_t length, char* output) noexcept
+        {
+#ifdef CPU_X86
+            static const auto narrow = cpu::select<decltype(&narrowUtf16Ssse3<endianness>)>({
+                {cpu::Feature::avx2, narrowUtf16Avx2<endianness>},
+                {cpu::Feature::ssse3, narrowUtf16Ssse3<endianness>}
+            }, nullptr);
+            return narrow ? narrow(input, length, output) : 0;
+#else
+            (void)input;
+            (void)length;
+            (void)output;
+            return 0;
+#endif
+        }
+
+        // measures whole blocks without surrogates, returns the number of code units consumed
+        template <Endianness endianness>
+        std::size_t utf8LengthBlocks(const char16_t* input, const std::size_t length, std::size_t& size) noexcept
+        {
+#ifdef CPU_X86
+            static const auto measure = cpu::select<decltype(&utf8LengthSsse3<endianness>)>({
+                {cpu::Feature::avx2, utf8LengthAvx2<endianness>},
+                {cpu::Feature::ssse3, utf8LengthSsse3<endianness>}
+            }, nullptr);
+            return measure ? measure(input, length, size) : 0;
+#else
+            (void)input;
+            (void)length;
+            (void)size;
+            return 0;
+#endif
+        }
+
+        inline std::size_t narrowUtf32(const char32_t* input, const std::size_t length, char* output) noexcept
+        {
+#ifdef CPU_X86
+            static const auto narrow = cpu::select<decltype(&narrowUtf32Ssse3)>({
+                {cpu::Feature::avx2, narrowUtf32Avx2},
+                {cpu::Feature::ssse3, narrowUtf32Ssse3}
+            }, nullptr);
+            return narrow ? narrow(input, length, output) : 0;
+#else
+            (void)input;
+            (void)length;
+            (void)output;
+            return 0;
+#endif
+        }
+
+        // measures whole blocks of valid code points, returns the number of code points consumed
+        inline std::size_t utf8LengthBlocks(const char32_t* input, const std::size_t length, std::size_t& size) noexcept
+        {
+#ifdef CPU_X86
+            static const auto measure = cpu::select<decltype(&utf8LengthUtf32Ssse3)>({
+                {cpu::Feature::avx2, utf8LengthUtf32Avx2},
+                {cpu::Feature::ssse3, utf8LengthUtf32Ssse3}
+            }, nullptr);
+            return measure ? measure(input, length, size) : 0;
+#else
+            (void)input;
+            (void)length;
+            (void)size;
+            return 0;
+#endif
+        }
+    }
+
+    template <typename T, std::enable_if_t<sizeof(T) == 1>* = nullptr>
+    Result validate(const T* input, const std::size_t length) noexcept
+    {
+        const std::size_t position = findError(reinterpret_cast<const std::uint8_t*>(input), length);
+        return {position, position == length ? Error::none : Error::invalidSequence, position};
+    }
+
+    template <typename Iterator>
+    Result validate(const Iterator begin, const Iterator end)
+    {
+        if constexpr (isBytePointer<Iterator>)
+            return validate(begin, static_cast<std::size_t>(end - begin));
+        else
+        {
+            std::size_t position = 0;
+            for (auto i = begin; i != end;)
+            {
+                char32_t cp;
+                if (!decodeNext(i, end, cp)) return {position, Error::invalidSequence, position};
+                position += getEncodedLength(cp);
+            }
+            return {position, Error::none, position};
+        }
+    }
+
+    template <typename T>
+    Result validate(const T& text)
+    {
+        if constexpr (IsContiguous<T>::value)
+            return validate(std::data(text), std::size(text));
+        else
+            return validate(std::begin(text), std::end(text));
+    }
+
+    // counts the code points of valid input, or of the valid prefix in front of the first error
+    template <typename T, std::enable_if_t<sizeof(T) == 1>* = nullptr>
+    Result countCodePoints(const T* input, const std::size_t length) noexcept
+    {
+        const auto bytes = reinterpret_cast<const std::uint8_t*>(input);
+        const std::size_t position = findError(bytes, length);
+        return {countLeadBytes(bytes, position), position == length ? Error::none : Error::invalidSequence, position};
+    }
+
+    template <typename Iterator>
+    Result countCodePoints(const Iterator begin, const Iterator end)
+    {
+        if constexpr (isBytePointer<Iterator>)
+            return countCodePoints(begin, static_cast<std::size_t>(end - begin));
+        else
+        {
+            std::size_t count = 0;
+            std::size_t position = 0;
+            for (auto i = begin; i != end; ++count)
+            {
+                char32_t cp;
+                if (!decodeNext(i, end, cp)) return {count, Error::invalidSequence, position};
+                position += getEncodedLength(cp);
+            }
+            return {count, Error::none, position};
+        }
+    }
+
+    template <typename T>
+    Result countCodePoints(const T& text)
+    {
+        if constexpr (IsContiguous<T>::value)
+            return countCodePoints(std::data(text), std::size(text));
+        else
+            return countCodePoints(std::begin(text), std::end(text));
+    }
+
+    // decodes into the caller's buffer, size is the number of code points written and position the number
+    // of bytes consumed, which stops at the first invalid sequence or at the first one that does not fit
+    template <typename T, std::enable_if_t<sizeof(T) == 1>* = nullptr>
+    Result toUtf32(const T* input, const std::size_t length, char32_t* output, const std::size_t capacity) noexcept
+    {
+        const auto bytes = reinterpret_cast<const std::uint8_t*>(input);
+        const auto end = bytes + length;
+
+        std::size_t i = 0;
+        std::size_t o = 0;
+
+        while (i != length)
+        {
+            if (bytes[i] <= 0x7F)
+            {
+                const std::size_t ascii = widenAscii(bytes + i, std::min(length - i, capacity - o), output + o);
+                i += ascii;
+                o += ascii;
+                for (; i != length && bytes[i] <= 0x7F; ++i, ++o)
+                {
+                    if (o == capacity) return {o, Error::outputTooSmall, i};
+                    output[o] = bytes[i];
+                }
+            }
+            else
+            {
+                auto p = bytes + i;
+                char32_t cp;
+                if (!decodeNext(p, end, cp)) return {o, Error::invalidSequence, i};
+                if (o == capacity) return {o, Error::outputTooSmall, i};
+
+                output[o++] = cp;
+                i = static_cast<std::size_t>(p - bytes);
+            }
+        }
+
+        return {o, Error::none, i};
+    }
+
+    template <typename Iterator>
+    std::u32string toUtf32(const Iterator begin, const Iterator end)
+    {
+        std::u32string result;
+
+        if constexpr (isBytePointer<Iterator>)
+        {
+            const auto input = reinterpret_cast<const std::uint8_t*>(begin);
+            const auto length = static_cast<std::size_t>(end - begin);
+            if (!isValid(input, length))
+                throw ParseError("Invalid UTF-8 string");
+
+            result.resize(length);
+            result.resize(decodeValidBuffer(input, length, &result[0]));
+        }
+        else
+        {
+            for (auto i = begin; i != end;)
+            {
+                char32_t cp;
+                if (!decodeNext(i, end, cp))
+                    throw ParseError("Invalid UTF-8 string");
+                result.push_back(cp);
+            }
+        }
+
+        return result;
+    }
+
+    template <typename T>
+    std::u32string toUtf32(const T& text)
+    {
+        if constexpr (IsContiguous<T>::value)
+            return toUtf32(std::data(text), std::data(text) + std::size(text));
+        else
+            return toUtf32(std::begin(text), std::end(text));
+    }
+
+    // number of UTF-16 code units the input (or its valid prefix) transcodes to
+    template <typename T, std::enable_if_t<sizeof(T) == 1>* = nullptr>
+    Result utf16Length(const T* input, const std::size_t length) noexcept
+    {
+        const auto bytes = reinterpret_cast<const std::uint8_t*>(input);
+        const std::size_t position = findError(bytes, length);
+        // four-byte sequences become surrogate pairs
+        return {countLeadBytes(bytes, position) + countLeadBytes<true>(bytes, position),
+                position == length ? Error::none : Error::invalidSequence, position};
+    }
+
+    // transcodes into the caller's buffer, size is the number of code units written and position the number
+    // of bytes consumed, which stops at the first invalid sequence or at the first one that does not fit
+    template <Endianness endianness = Endianness::native, typename T, std::enable_if_t<sizeof(T) == 1>* = nullptr>
+    Result toUtf16(const T* input, const std::size_t length, char16_t* output, const std::size_t capacity) noexcept
+    {
+        const auto bytes = reinterpret_cast<const std::uint8_t*>(input);
+        const auto end = bytes + length;
+
+        std::size_t i = 0;
+        std::size_t o = 0;
+
+        while (i != length)
+        {
+            if (bytes[i] <= 0x7F)
+            {
+                const std::size_t ascii = widenUtf16<endianness>(bytes + i, std::min(length - i, capacity - o), output + o);
+                i += ascii;
+                o += ascii;
+                for (; i != length && bytes[i] <= 0x7F; ++i, ++o)
+                {
+                    if (o == capacity) return {o, Error::outputTooSmall, i};
+                    output[o] = convert<endianness>(bytes[i]);
+                }
+            }
+            else
+            {
+                auto p = bytes + i;
+                char32_t cp;
+                if (!decodeNext(p, end, cp)) return {o, Error::invalidSequence, i};
+                if (capacity - o < (cp > 0xFFFF ? 2U : 1U)) return {o, Error::outputTooSmall, i};
+
+                o += encodeUtf16<endianness>(cp, output + o);
+                i = static_cast<std::size_t>(p - bytes);
+            }
+        }
+
+        return {o, Error::none, i};
+    }
+
     template <typename Iterator>
-    std::u32string toUtf32(const Iterator begin, const Iterator end)
+    std::u16string toUtf16(const Iterator begin, const Iterator end)
     {
-        std::u32string result;
+        std::u16string result;
 
-        for (auto i = begin; i != end; ++i)
+        if constexpr (isBytePointer<Iterator>)
         {
-            char32_t cp = *i & 0xFF;
+            const auto length = static_cast<std::size_t>(end - begin);
+            const Result size = utf16Length(begin, length);
+            if (size.error != Error::none)
+                throw ParseError("Invalid UTF-8 string");
 
-            if (cp <= 0x7F) // length = 1
+            result.resize(size.size);
+            toUtf16(begin, length, &result[0], result.size());
+        }
+        else
+        {
+            for (auto i = begin; i != end;)
             {
-                // do nothing
+                char32_t cp;
+                if (!decodeNext(i, end, cp))
+                    throw ParseError("Invalid UTF-8 string");
+
+                char16_t units[2];
+                result.append(units, encodeUtf16<Endianness::native>(cp, units));
             }
-            else if ((cp >> 5) == 0x6) // length = 2
+        }
+
+        return result;
+    }
+
+    template <typename T>
+    std::u16string toUtf16(const T& text)
+    {
+        if constexpr (IsContiguous<T>::value)
+            return toUtf16(std::data(text), std::data(text) + std::size(text));
+        else
+            return toUtf16(std::begin(text), std::end(text));
+    }
+
+    // number of UTF-8 bytes the input (or its valid prefix) transcodes to, unpaired surrogates are errors
+    template <Endianness endianness = Endianness::native, typename T, std::enable_if_t<sizeof(T) == 2>* = nullptr>
+    Result utf8Length(const T* input, const std::size_t length) noexcept
+    {
+        const auto units = reinterpret_cast<const char16_t*>(input);
+        const auto end = units + length;
+
+        std::size_t size = 0;
+        std::size_t i = 0;
+
+        while (i != length)
+        {
+            i += utf8LengthBlocks<endianness>(units + i, length - i, size);
+
+            // the block with a surrogate, or the tail
+            for (const std::size_t blockEnd = std::min(length, i + 16); i < blockEnd;)
             {
-                if (++i == end)
-                    throw ParseError("Invalid UTF-8 string");
-                cp = ((cp << 6) & 0x7FF) + (*i & 0x3F);
+                auto p = units + i;
+                char32_t cp;
+                if (!decodeNextUtf16<endianness>(p, end, cp)) return {size, Error::invalidSequence, i};
+                size += getEncodedLength(cp);
+                i = static_cast<std::size_t>(p - units);
             }
-            else if ((cp >> 4) == 0xE) // length = 3
+        }
+
+        return {size, Error::none, length};
+    }
+
+    // transcodes into the caller's buffer, size is the number of bytes written and position the number
+    // of code units consumed
+    template <Endianness endianness = Endianness::native, typename T, std::enable_if_t<sizeof(T) == 2>* = nullptr>
+    Result fromUtf16(const T* input, const std::size_t length, char* output, const std::size_t capacity) noexcept
+    {
+        const auto units = reinterpret_cast<const char16_t*>(input);
+        const auto end = units + length;
+
+        std::size_t i = 0;
+        std::size_t o = 0;
+
+        while (i != length)
+        {
+            if (convert<endianness>(units[i]) <= 0x7F)
             {
-                if (++i == end)
-                    throw ParseError("Invalid UTF-8 string");
-                cp = ((cp << 12) & 0xFFFF) + (((*i & 0xFF) << 6) & 0x0FFF);
-                if (++i == end)
-                    throw ParseError("Invalid UTF-8 string");
-                cp += *i & 0x3F;
+                const std::size_t ascii = narrowUtf16<endianness>(units + i, std::min(length - i, capacity - o), output + o);
+                i += ascii;
+                o += ascii;
+                for (; i != length && convert<endianness>(units[i]) <= 0x7F; ++i, ++o)
+                {
+                    if (o == capacity) return {o, Error::outputTooSmall, i};
+                    output[o] = static_cast<char>(convert<endianness>(units[i]));
+                }
             }
-            else if ((cp >> 3) == 0x1E) // length = 4
+            else
             {
-                if (++i == end)
-                    throw ParseError("Invalid UTF-8 string");
-                cp = ((cp << 18) & 0x1FFFFF) + (((*i & 0xFF) << 12) & 0x3FFFF);
-                if (++i == end)
-                    throw ParseError("Invalid UTF-8 string");
-                cp += ((*i & 0xFF) << 6) & 0x0FFF;
-                if (++i == end)
-                    throw ParseError("Invalid UTF-8 string");
-                cp += *i & 0x3F;
+                auto p = units + i;
+                char32_t cp;
+                if (!decodeNextUtf16<endianness>(p, end, cp)) return {o, Error::invalidSequence, i};
+                if (capacity - o < getEncodedLength(cp)) return {o, Error::outputTooSmall, i};
+
+                o += encodeUtf8(cp, output + o);
+                i = static_cast<std::size_t>(p - units);
             }
+        }
+
+        return {o, Error::none, i};
+    }
+
+    template <typename Iterator>
+    std::string fromUtf16(const Iterator begin, const Iterator end)
+    {
+        std::string result;
+
+        if constexpr (std::is_pointer_v<Iterator> &&
+                      sizeof(typename std::iterator_traits<Iterator>::value_type) == 2)
+        {
+            const auto length = static_cast<std::size_t>(end - begin);
+            const Result size = utf8Length(begin, length);
+            if (size.error != Error::none)
+                throw ParseError("Invalid UTF-16 string");
+
+            result.resize(size.size);
+            fromUtf16(begin, length, &result[0], result.size());
+        }
+        else
+        {
+            for (auto i = begin; i != end;)
+            {
+                char32_t cp;
+                if (!decodeNextUtf16<Endianness::native>(i, end, cp))
+                    throw ParseError("Invalid UTF-16 string");
 
-            result.push_back(cp);
+                char bytes[4];
+                result.append(bytes, encodeUtf8(cp, bytes));
+            }
         }
 
         return result;
     }
 
     template <typename T>
-    std::u32string toUtf32(const T& text)
+    std::string fromUtf16(const T& text)
+    {
+        if constexpr (IsContiguous<T>::value)
+            return fromUtf16(std::data(text), std::data(text) + std::size(text));
+        else
+            return fromUtf16(std::begin(text), std::end(text));
+    }
+
+    // writes the UTF-8 sequence of a code point (at most four bytes), returns its length
+    // or zero for surrogates and values above U+10FFFF
+    inline std::size_t fromUtf32(const char32_t c, char* output) noexcept
     {
-        return toUtf32(std::begin(text), std::end(text));
+        return isValidCodePoint(c) ? encodeUtf8(c, output) : 0;
     }
 
     inline std::string fromUtf32(const char32_t c)
     {
-        std::string result;
+        char bytes[4];
+        const std::size_t size = fromUtf32(c, bytes);
+        if (!size)
+            throw ParseError("Invalid code point");
+
+        return std::string(bytes, size);
+    }
+
+    // number of bytes the code points (or the valid ones in front of the first invalid one) encode to
+    template <typename T, std::enable_if_t<sizeof(T) == 4>* = nullptr>
+    Result utf8Length(const T* input, const std::size_t length) noexcept
+    {
+        const auto codePoints = reinterpret_cast<const char32_t*>(input);
+
+        std::size_t size = 0;
+        std::size_t i = 0;
+
+        while (i != length)
+        {
+            i += utf8LengthBlocks(codePoints + i, length - i, size);
+
+            // the block with an invalid code point, or the tail
+            for (const std::size_t blockEnd = std::min(length, i + 8); i != blockEnd; ++i)
+            {
+                if (!isValidCodePoint(codePoints[i])) return {size, Error::invalidSequence, i};
+                size += getEncodedLength(codePoints[i]);
+            }
+        }
+
+        return {size, Error::none, length};
+    }
+
+    // encodes into the caller's buffer, size is the number of bytes written and position the number
+    // of code points consumed
+    template <typename T, std::enable_if_t<sizeof(T) == 4>* = nullptr>
+    Result fromUtf32(const T* input, const std::size_t length, char* output, const std::size_t capacity) noexcept
+    {
+        const auto codePoints = reinterpret_cast<const char32_t*>(input);
+
+        std::size_t i = 0;
+        std::size_t o = 0;
 
-        if (c <= 0x7F)
-            result.push_back(static_cast<char>(c));
-        else if (c <= 0x7FF)
+        while (i != length)
         {
-            result.push_back(static_cast<char>(0xC0 | ((c >> 6) & 0x1F)));
-            result.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+            const char32_t cp = codePoints[i];
+            if (cp <= 0x7F)
+            {
+                const std::size_t ascii = narrowUtf32(codePoints + i, std::min(length - i, capacity - o), output + o);
+                i += ascii;
+                o += ascii;
+                for (; i != length && codePoints[i] <= 0x7F; ++i, ++o)
+                {
+                    if (o == capacity) return {o, Error::outputTooSmall, i};
+                    output[o] = static_cast<char>(codePoints[i]);
+                }
+            }
+            else if (cp <= 0x7FF)
+            {
+                // runs of two-byte sequences are written with one 16-bit store each
+                for (; i != length && codePoints[i] - 0x80 < 0x780; ++i, o += 2)
+                {
+                    if (capacity - o < 2) return {o, Error::outputTooSmall, i};
+                    const auto lead = static_cast<std::uint16_t>(0xC0 | (codePoints[i] >> 6));
+                    const auto trail = static_cast<std::uint16_t>(0x80 | (codePoints[i] & 0x3F));
+                    const auto pair = static_cast<std::uint16_t>(Endianness::native == Endianness::little ?
+                                                                 lead | (trail << 8) : (lead << 8) | trail);
+                    std::memcpy(output + o, &pair, sizeof(pair));
+                }
+            }
+            else
+            {
+                if (!isValidCodePoint(cp)) return {o, Error::invalidSequence, i};
+                if (capacity - o < getEncodedLength(cp)) return {o, Error::outputTooSmall, i};
+                o += encodeUtf8(cp, output + o);
+                ++i;
+            }
         }
-        else if (c <= 0xFFFF)
+
+        return {o, Error::none, i};
+    }
+
+    template <typename Iterator>
+    std::string fromUtf32(const Iterator begin, const Iterator end)
+    {
+        std::string result;
+
+        if constexpr (std::is_pointer_v<Iterator> &&
+                      sizeof(typename std::iterator_traits<Iterator>::value_type) == 4)
         {
-            result.push_back(static_cast<char>(0xE0 | ((c >> 12) & 0x0F)));
-            result.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
-            result.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+            const auto length = static_cast<std::size_t>(end - begin);
+            const Result size = utf8Length(begin, length);
+            if (size.error != Error::none)
+                throw ParseError("Invalid code point");
+
+            result.resize(size.size);
+            fromUtf32(begin, length, &result[0], result.size());
         }
         else
         {
-            result.push_back(static_cast<char>(0xF0 | ((c >> 18) & 0x07)));
-            result.push_back(static_cast<char>(0x80 | ((c >> 12) & 0x3F)));
-            result.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
-            result.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+            for (auto i = begin; i != end; ++i)
+            {
+                char bytes[4];
+                const std::size_t size = fromUtf32(static_cast<char32_t>(*i), bytes);
+                if (!size)
+                    throw ParseError("Invalid code point");
+                result.append(bytes, size);
+            }
         }
 
         return result;
     }
 
-    template <typename Iterator>
-    std::string fromUtf32(const Iterator begin, const Iterator end)
+    template <typename T>
+    std::string fromUtf32(const T& text)
     {
-        std::string result;
+        if constexpr (IsContiguous<T>::value)
+            return fromUtf32(std::data(text), std::data(text) + std::size(text));
+        else
+            return fromUtf32(std::begin(text), std::end(text));
+    }
+
+    // iterates the code points of a UTF-8 string without copying or decoding it up front, each byte that is
+    // not part of a valid sequence is a code point of its own, which dereferences to U+FFFD in replacing mode
+    // and throws ParseError otherwise
+    class View final
+    {
+    public:
+        static constexpr char32_t replacementCharacter = 0xFFFD;
+
+        class Iterator final
+        {
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = char32_t;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const char32_t*;
+            using reference = char32_t;
+
+            Iterator() noexcept = default;
+
+            char32_t operator*() const
+            {
+                if (!valid && !replaceInvalid)
+                    throw ParseError("Invalid UTF-8 sequence");
+                return cp;
+            }
+
+            Iterator& operator++() noexcept
+            {
+                decode(current + length);
+                return *this;
+            }
+
+            Iterator operator++(int) noexcept
+            {
+                Iterator result = *this;
+                ++(*this);
+                return result;
+            }
 
-        for (auto i = begin; i != end; ++i)
+            Iterator& operator--() noexcept
+            {
+                // the lead byte is at most three continuation bytes back, unless the previous byte is invalid
+                const char* lead = current - 1;
+                const char* limit = current - begin > 4 ? current - 4 : begin;
+                while (lead != limit && (static_cast<std::uint8_t>(*lead) & 0xC0) == 0x80) --lead;
+
+                auto i = lead;
+                if (decodeNext(i, end, cp) && i == current)
+                {
+                    length = static_cast<std::uint8_t>(current - lead);
+                    valid = true;
+                    current = lead;
+                }
+                else
+                {
+                    --current;
+                    invalidate();
+                }
+                return *this;
+            }
+
+            Iterator operator--(int) noexcept
+            {
+                Iterator result = *this;
+                --(*this);
+                return result;
+            }
+
+            bool operator==(const Iterator& other) const noexcept { return current == other.current; }
+            bool operator!=(const Iterator& other) const noexcept { return current != other.current; }
+
+            // byte offset of the code point in the viewed string
+            std::size_t offset() const noexcept { return static_cast<std::size_t>(current - begin); }
+            // number of bytes of the code point, one for an invalid byte
+            std::size_t size() const noexcept { return length; }
+            bool isValid() const noexcept { return valid; }
+
+        private:
+            friend View;
+
+            Iterator(const char* b, const char* e, const char* position, const bool replace) noexcept:
+                begin{b}, end{e}, replaceInvalid{replace}
+            {
+                decode(position);
+            }
+
+            void decode(const char* position) noexcept
+            {
+                current = position;
+                if (current == end)
+                {
+                    length = 0;
+                    valid = true;
+                    return;
+                }
+
+                auto i = current;
+                if (decodeNext(i, end, cp))
+                {
+                    length = static_cast<std::uint8_t>(i - current);
+                    valid = true;
+                }
+                else
+                    invalidate();
+            }
+
+            void invalidate() noexcept
+            {
+                cp = replacementCharacter;
+                length = 1;
+                valid = false;
+            }
+
+            const char* begin = nullptr;
+            const char* end = nullptr;
+            const char* current = nullptr;
+            char32_t cp = 0;
+            std::uint8_t length = 0;
+            bool valid = true;
+            bool replaceInvalid = false;
+        };
+
+        using iterator = Iterator;
+        using const_iterator = Iterator;
+        using reverse_iterator = std::reverse_iterator<Iterator>;
+        using const_reverse_iterator = std::reverse_iterator<Iterator>;
+
+        View() noexcept = default;
+        explicit View(const std::string_view t, const bool replace = false) noexcept:
+            text{t}, replaceInvalid{replace}
+        {
+        }
+
+        Iterator begin() const noexcept { return {text.data(), text.data() + text.size(), text.data(), replaceInvalid}; }
+        Iterator end() const noexcept
+        {
+            return {text.data(), text.data() + text.size(), text.data() + text.size(), replaceInvalid};
+        }
+        reverse_iterator rbegin() const noexcept { return reverse_iterator{end()}; }
+        reverse_iterator rend() const noexcept { return reverse_iterator{begin()}; }
+
+        bool empty() const noexcept { return text.empty(); }
+        std::string_view data() const noexcept { return text; }
+
+        // the code point that contains the byte at the offset, or the end for offsets past it
+        Iterator seek(const std::size_t offset) const noexcept
+        {
+            if (offset >= text.size()) return end();
+
+            const char* position = text.data() + offset;
+            if ((static_cast<std::uint8_t>(*position) & 0xC0) == 0x80)
+            {
+                const char* lead = position;
+                const char* limit = offset > 3 ? position - 3 : text.data();
+                while (lead != limit && (static_cast<std::uint8_t>(*lead) & 0xC0) == 0x80) --lead;
+
+                const Iterator candidate{text.data(), text.data() + text.size(), lead, replaceInvalid};
+                if (candidate.valid && lead + candidate.length > position) return candidate;
+            }
+
+            return {text.data(), text.data() + text.size(), position, replaceInvalid};
+        }
+
+    private:
+        std::string_view text;
+        bool replaceInvalid = false;
+    };
+
+    enum class NormalizationForm
+    {
+        nfc, // canonical composition
+        nfd // canonical decomposition
+    };
+
+    inline namespace detail
+    {
+        struct FoldRange final
+        {
+            char32_t first;
+            char32_t last;
+            std::int32_t delta;
+            std::uint32_t stride;
+        };
+
+        // Unicode 14.0 character data, each code point has a 16-bit property word in a two-stage table
+        // (blocks of 32 code points, identical blocks are shared), the mappings are sorted for binary search
+        constexpr std::uint32_t propertyShift = 5;
+        constexpr std::uint16_t combiningClassMask = 0xFF;
+        constexpr std::uint16_t nfdNo = 0x100; // has a canonical decomposition
+        constexpr std::uint16_t nfcNo = 0x200; // never occurs in NFC
+        constexpr std::uint16_t nfcMaybe = 0x400; // can combine with the preceding code point
+        constexpr std::uint16_t hasFold = 0x800; // has a simple case folding
+
+        // decompositions hold the code point in bits 42-62 and its canonical decomposition (one or two code points)
+        // in bits 21-41 and 0-20, compositions index the primary composites in decompositions sorted by their pair
+
+        constexpr std::array<std::uint8_t, 6097> propertyIndex = {
+            0, 0, 1, 0, 0, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 0, 0, 0, 0,
+            16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 29, 32, 33, 0, 34, 35, 36, 0,
+            37, 38, 39, 40, 0, 0, 41, 42, 43, 44, 45, 0, 0, 0, 0, 46, 47, 48, 49, 0, 50, 0, 51, 52,
+            0, 53, 54, 0, 0, 55, 56, 57, 0, 58, 59, 0, 0, 60, 61, 0, 0, 55, 62, 0, 63, 64, 65, 0,
+            0, 60, 66, 0, 0, 60, 67, 0, 0, 68, 65, 0, 0, 0, 69, 0, 0, 70, 71, 0, 0, 72, 73, 0,
+            74, 75, 76, 77, 78, 79, 80, 0, 0, 81, 0, 0, 82, 83, 84, 0, 0, 0, 0, 85, 0, 86, 87, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 88, 0, 0, 0, 0, 89, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 90, 91, 0, 0, 0, 0, 92, 0,
+            0, 0, 0, 0, 0, 93, 0, 0, 0, 94, 0, 0, 0, 0, 0, 0, 95, 0, 0, 96, 0, 97, 98, 0,
+            99, 100, 101, 102, 0, 103, 0, 104, 0, 105, 0, 0, 106, 107, 108, 109, 0, 0, 0, 0, 0, 0, 110, 111,
+            112, 112, 112, 112, 113, 112, 112, 114, 115, 116, 117, 118, 116, 119, 120, 121, 122, 0, 0, 0, 0, 0, 123, 124,
+            0, 125, 0, 126, 127, 128, 129, 0, 130, 131, 132, 133, 134, 135, 0, 136, 0, 137, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 138, 126, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 139, 0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 126, 0, 140, 29, 29, 29, 141,
+            0, 0, 0, 142, 0, 0, 0, 143, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 144, 145, 146, 147, 145, 146, 148, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 149, 150, 0, 0, 151, 0, 152, 29, 153, 154, 155, 156, 2,
+            157, 158, 0, 0, 0, 0, 159, 160, 0, 161, 162, 0, 0, 163, 164, 0, 0, 0, 0, 0, 0, 165, 166, 167,
+            0, 0, 0, 168, 83, 83, 0, 61, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+            169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+            169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+            169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+            169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+            169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+            169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+            169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+            169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+            169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+            169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+            169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+            169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+            169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+            169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 170, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            171, 171, 171, 171, 171, 171, 171, 171, 172, 173, 171, 174, 171, 171, 175, 0, 176, 177, 178, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 179, 0, 0, 0, 0, 0, 0,
+            0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 180,
+            0, 0, 0, 0, 0, 0, 0, 181, 0, 0, 0, 182, 0, 0, 0, 0, 83, 183, 0, 0, 0, 168, 184, 0,
+            0, 0, 0, 185, 186, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 187, 188, 0, 0, 0, 0, 0, 189,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 190, 0, 0, 0, 191, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 192, 0, 0, 0, 0, 193, 0, 194, 0, 0, 0, 0, 0, 157, 195, 196, 197, 0, 0,
+            198, 199, 0, 163, 0, 0, 200, 0, 0, 201, 0, 0, 0, 0, 0, 202, 0, 203, 204, 205, 0, 0, 0, 0,
+            0, 0, 206, 0, 0, 207, 208, 0, 0, 0, 0, 0, 0, 209, 210, 0, 0, 142, 0, 0, 0, 211, 0, 0,
+            0, 212, 0, 0, 0, 0, 0, 0, 0, 213, 0, 0, 0, 83, 0, 0, 0, 214, 215, 0, 0, 0, 0, 164,
+            0, 91, 216, 0, 217, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 142, 0, 0, 0, 0, 0, 0,
+            0, 0, 218, 0, 219, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220,
+            0, 221, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 222, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 223, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 224, 225, 226, 227, 228, 0, 0, 0, 229, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            230, 231, 0, 0, 0, 0, 0, 0, 0, 221, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 232, 0, 233,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 234, 0,
+            83, 235, 236, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+            237
+        };
+
+        constexpr std::array<std::uint16_t, 7616> propertyBlocks = {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800,
+            0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0x800, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x800, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900,
+            0x800, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0, 0x800, 0x900, 0x900, 0x900, 0x900, 0x900, 0x800, 0,
+            0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+            0, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0, 0, 0x100, 0x100, 0x100, 0x100, 0x100, 0, 0x100,
+            0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100,
+            0x800, 0, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100,
+            0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x800, 0, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100,
+            0x100, 0, 0x800, 0, 0x900, 0x100, 0x900, 0x100, 0, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x800,
+            0, 0x800, 0, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0, 0x800, 0, 0x900, 0x100, 0x900, 0x100,
+            0x900, 0x100, 0x800, 0, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100,
+            0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x800, 0, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100,
+            0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x800,
+            0, 0x800, 0x800, 0, 0x800, 0, 0x800, 0x800, 0, 0x800, 0x800, 0x800, 0, 0, 0x800, 0x800,
+            0x800, 0x800, 0, 0x800, 0x800, 0, 0x800, 0x800, 0x800, 0, 0, 0, 0x800, 0x800, 0, 0x800,
+            0x900, 0x100, 0x800, 0, 0x800, 0, 0x800, 0x800, 0, 0x800, 0, 0, 0x800, 0, 0x800, 0x900,
+            0x100, 0x800, 0x800, 0x800, 0, 0x800, 0, 0x800, 0x800, 0, 0, 0, 0x800, 0, 0, 0,
+            0, 0, 0, 0, 0x800, 0x800, 0, 0x800, 0x800, 0, 0x800, 0x800, 0, 0x900, 0x100, 0x900,
+            0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0, 0x900, 0x100,
+            0x900, 0x100, 0x900, 0x100, 0x800, 0, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100,
+            0x100, 0x800, 0x800, 0, 0x900, 0x100, 0x800, 0x800, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100,
+            0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100,
+            0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x800, 0, 0x900, 0x100,
+            0x800, 0, 0x800, 0, 0x800, 0, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100,
+            0x900, 0x100, 0x900, 0x100, 0, 0, 0, 0, 0, 0, 0x800, 0x800, 0, 0x800, 0x800, 0,
+            0, 0x800, 0, 0x800, 0x800, 0x800, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0x4E6, 0x4E6, 0x4E6, 0x4E6, 0x4E6, 0xE6, 0x4E6, 0x4E6, 0x4E6, 0x4E6, 0x4E6, 0x4E6, 0x4E6, 0xE6, 0xE6, 0x4E6,
+            0xE6, 0x4E6, 0xE6, 0x4E6, 0x4E6, 0xE8, 0xDC, 0xDC, 0xDC, 0xDC, 0xE8, 0x4D8, 0xDC, 0xDC, 0xDC, 0xDC,
+            0xDC, 0xCA, 0xCA, 0x4DC, 0x4DC, 0x4DC, 0x4DC, 0x4CA, 0x4CA, 0xDC, 0xDC, 0xDC, 0xDC, 0x4DC, 0x4DC, 0xDC,
+            0x4DC, 0x4DC, 0xDC, 0xDC, 0x1, 0x1, 0x1, 0x1, 0x401, 0xDC, 0xDC, 0xDC, 0xDC, 0xE6, 0xE6, 0xE6,
+            0x3E6, 0x3E6, 0x4E6, 0x3E6, 0x3E6, 0xCF0, 0xE6, 0xDC, 0xDC, 0xDC, 0xE6, 0xE6, 0xE6, 0xDC, 0xDC, 0,
+            0xE6, 0xE6, 0xE6, 0xDC, 0xDC, 0xDC, 0xDC, 0xE6, 0xE8, 0xDC, 0xDC, 0xE6, 0xE9, 0xEA, 0xEA, 0xE9,
+            0xEA, 0xEA, 0xE9, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6,
+            0x800, 0, 0x800, 0, 0x300, 0, 0x800, 0, 0, 0, 0, 0, 0, 0, 0x300, 0x800,
+            0, 0, 0, 0, 0, 0x100, 0x900, 0x300, 0x900, 0x900, 0x900, 0, 0x900, 0, 0x900, 0x900,
+            0x100, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800,
+            0x800, 0x800, 0, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x900, 0x900, 0x100, 0x100, 0x100, 0x100,
+            0x100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0x800, 0, 0, 0, 0, 0, 0, 0, 0x100, 0x100, 0x100, 0x100, 0x100, 0x800,
+            0x800, 0x800, 0, 0x100, 0x100, 0x800, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0,
+            0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0,
+            0x800, 0x800, 0, 0, 0x800, 0x800, 0, 0x800, 0, 0x800, 0x800, 0, 0, 0x800, 0x800, 0x800,
+            0x900, 0x900, 0x800, 0x900, 0x800, 0x800, 0x800, 0x900, 0x800, 0x800, 0x800, 0x800, 0x900, 0x900, 0x900, 0x800,
+            0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x900, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800,
+            0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0x100, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0x100, 0x100, 0, 0x100, 0, 0, 0, 0x100, 0, 0, 0, 0, 0x100, 0x100, 0x100, 0,
+            0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0,
+            0x800, 0, 0x800, 0, 0x800, 0, 0x900, 0x100, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0,
+            0x800, 0, 0, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0, 0, 0x800, 0, 0x800, 0, 0x800, 0,
+            0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0,
+            0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0,
+            0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0,
+            0x800, 0x900, 0x100, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0,
+            0x900, 0x100, 0x900, 0x100, 0x800, 0, 0x900, 0x100, 0x800, 0, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100,
+            0x800, 0, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x800, 0, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100,
+            0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x800, 0, 0x900, 0x100, 0x800, 0, 0x800, 0, 0x800, 0,
+            0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0,
+            0, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800,
+            0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800,
+            0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0xDC, 0xE6, 0xE6, 0xE6, 0xE6, 0xDC, 0xE6, 0xE6, 0xE6, 0xDE, 0xDC, 0xE6, 0xE6, 0xE6, 0xE6,
+            0xE6, 0xE6, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xE6, 0xE6, 0xDC, 0xE6, 0xE6, 0xDE, 0xE4, 0xE6,
+            0xA, 0xB, 0xC, 0xD, 0xE, 0xF, 0x10, 0x11, 0x12, 0x13, 0x13, 0x14, 0x15, 0x16, 0, 0x17,
+            0, 0x18, 0x19, 0, 0xE6, 0xDC, 0, 0x12, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0x1E, 0x1F, 0x20, 0, 0, 0, 0, 0,
+            0, 0, 0x100, 0x100, 0x100, 0x100, 0x100, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
+            0x20, 0x21, 0x22, 0x4E6, 0x4E6, 0x4DC, 0xDC, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xDC, 0xE6, 0xE6, 0xDC,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0x23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0x100, 0, 0x100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0x100, 0, 0, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0, 0, 0xE6,
+            0xE6, 0xE6, 0xE6, 0xDC, 0xE6, 0, 0, 0xE6, 0xE6, 0, 0xDC, 0xE6, 0xE6, 0xDC, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0x24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0xE6, 0xDC, 0xE6, 0xE6, 0xDC, 0xE6, 0xE6, 0xDC, 0xDC, 0xDC, 0xE6, 0xDC, 0xDC, 0xE6, 0xDC, 0xE6,
+            0xE6, 0xE6, 0xDC, 0xE6, 0xDC, 0xE6, 0xDC, 0xE6, 0xDC, 0xE6, 0xE6, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6,
+            0xE6, 0xE6, 0xDC, 0xE6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xDC, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0xE6, 0xE6, 0xE6, 0xE6, 0, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6,
+            0xE6, 0xE6, 0xE6, 0xE6, 0, 0xE6, 0xE6, 0xE6, 0, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0xDC, 0xDC, 0xDC, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0xE6, 0xDC, 0xDC, 0xDC, 0xE6, 0xE6, 0xE6, 0xE6,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xDC,
+            0xDC, 0xDC, 0xDC, 0xDC, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6,
+            0xE6, 0xE6, 0, 0xDC, 0xE6, 0xE6, 0xDC, 0xE6, 0xE6, 0xDC, 0xE6, 0xE6, 0xE6, 0xDC, 0xDC, 0xDC,
+            0x1B, 0x1C, 0x1D, 0xE6, 0xE6, 0xE6, 0xDC, 0xE6, 0xE6, 0xDC, 0xDC, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0x100, 0, 0, 0, 0, 0, 0,
+            0, 0x100, 0, 0, 0x100, 0, 0, 0, 0, 0, 0, 0, 0x407, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x9, 0, 0,
+            0, 0xE6, 0xDC, 0xE6, 0xE6, 0, 0, 0, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x7, 0, 0x400, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x100, 0x100, 0x9, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0x400, 0, 0, 0, 0, 0x300, 0x300, 0, 0x300,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xE6, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0x300, 0, 0, 0x300, 0, 0, 0, 0, 0, 0x7, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x9, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0x300, 0x300, 0x300, 0, 0, 0x300, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x7, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x9, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0x100, 0, 0, 0x100, 0x100, 0x9, 0, 0,
+            0, 0, 0, 0, 0, 0, 0x400, 0x400, 0, 0, 0, 0, 0x300, 0x300, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0x100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x400, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x100, 0x100, 0x100, 0x9, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0x400, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0x100, 0, 0, 0, 0, 0x9, 0, 0,
+            0, 0, 0, 0, 0, 0x54, 0x45B, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0x100, 0, 0x400, 0, 0, 0, 0, 0x100, 0x100, 0, 0x100, 0x100, 0, 0x9, 0, 0,
+            0, 0, 0, 0, 0, 0x400, 0x400, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x9, 0x9, 0, 0x400, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x409, 0, 0, 0, 0, 0x400,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x100, 0, 0x100, 0x100, 0x100, 0x400,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0x67, 0x67, 0x9, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0x6B, 0x6B, 0x6B, 0x6B, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0x76, 0x76, 0x9, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0x7A, 0x7A, 0x7A, 0x7A, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0xDC, 0xDC, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0xDC, 0, 0xDC, 0, 0xD8, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0x300, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x300, 0, 0,
+            0, 0, 0x300, 0, 0, 0, 0, 0x300, 0, 0, 0, 0, 0x300, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0x300, 0, 0, 0, 0, 0, 0,
+            0, 0x81, 0x82, 0x300, 0x84, 0x300, 0x300, 0, 0x300, 0, 0x82, 0x82, 0x82, 0x82, 0, 0,
+            0x82, 0x300, 0xE6, 0xE6, 0x9, 0, 0xE6, 0xE6, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0x300, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x300, 0, 0,
+            0, 0, 0x300, 0, 0, 0, 0, 0x300, 0, 0, 0, 0, 0x300, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0x300, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0xDC, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0x100, 0, 0, 0, 0, 0, 0, 0, 0x400, 0,
+            0, 0, 0, 0, 0, 0, 0, 0x7, 0, 0x9, 0x9, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xDC, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800,
+            0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800,
+            0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0, 0x800, 0, 0, 0, 0, 0, 0x800, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400,
+            0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400,
+            0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400,
+            0x400, 0x400, 0x400, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xE6, 0xE6, 0xE6,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0x9, 0x9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0x9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0x9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xE6, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0xE4, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0xDE, 0xE6, 0xDC, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0xE6, 0xDC, 0, 0, 0, 0, 0, 0, 0,
+            0x9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0, 0, 0xDC,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xE6, 0xE6, 0xDC, 0, 0xDC,
+            0xDC, 0xE6, 0xE6, 0xDC, 0xDC, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xDC, 0xE6, 0xE6, 0xE6, 0xE6, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0x100, 0, 0x100, 0, 0x100, 0, 0x100, 0, 0x100, 0,
+            0, 0, 0x100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0x7, 0x400, 0, 0, 0, 0, 0, 0x100, 0, 0x100, 0, 0,
+            0x100, 0x100, 0, 0x100, 0x9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xE6, 0xDC, 0xE6, 0xE6, 0xE6,
+            0xE6, 0xE6, 0xE6, 0xE6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x9, 0x9, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0x7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0x9, 0x9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0x7, 0, 0, 0, 0, 0, 0, 0, 0,
+            0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0, 0, 0, 0, 0, 0, 0,
+            0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800,
+            0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800,
+            0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0, 0, 0x800, 0x800, 0x800,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0xE6, 0xE6, 0xE6, 0, 0x1, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xE6, 0xE6, 0xDC, 0xDC, 0xDC, 0xDC,
+            0xE6, 0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0, 0, 0, 0, 0xDC, 0, 0,
+            0, 0, 0, 0, 0xE6, 0, 0, 0, 0xE6, 0xE6, 0, 0, 0, 0, 0, 0,
+            0xE6, 0xE6, 0xDC, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xDC, 0xE6, 0xE6, 0xEA, 0xD6, 0xDC,
+            0xCA, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6,
+            0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6,
+            0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE8, 0xE4, 0xE4, 0xDC, 0xDA, 0xE6, 0xE9, 0xDC, 0xE6, 0xDC,
+            0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100,
+            0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100,
+            0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100,
+            0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x100, 0x100, 0x100, 0x100, 0, 0x900, 0, 0, 0x800, 0,
+            0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100,
+            0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x900, 0x100, 0x800, 0, 0x800, 0, 0x800, 0,
+            0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900,
+            0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0, 0, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0, 0,
+            0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900,
+            0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900,
+            0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0, 0, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0, 0,
+            0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0, 0x900, 0, 0x900, 0, 0x900, 0, 0x900,
+            0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900,
+            0x100, 0x300, 0x100, 0x300, 0x100, 0x300, 0x100, 0x300, 0x100, 0x300, 0x100, 0x300, 0x100, 0x300, 0, 0,
+            0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900, 0x900,
+            0x100, 0x100, 0x100, 0x100, 0x100, 0, 0x100, 0x100, 0x900, 0x900, 0x900, 0xB00, 0x900, 0, 0xB00, 0,
+            0, 0x100, 0x100, 0x100, 0x100, 0, 0x100, 0x100, 0x900, 0xB00, 0x900, 0xB00, 0x900, 0x100, 0x100, 0x100,
+            0x100, 0x100, 0x100, 0x300, 0, 0, 0x100, 0x100, 0x900, 0x900, 0x900, 0xB00, 0, 0x100, 0x100, 0x100,
+            0x100, 0x100, 0x100, 0x300, 0x100, 0x100, 0x100, 0x100, 0x900, 0x900, 0x900, 0xB00, 0x900, 0x100, 0x300, 0x300,
+            0, 0, 0x100, 0x100, 0x100, 0, 0x100, 0x100, 0x900, 0xB00, 0x900, 0xB00, 0x900, 0x300, 0, 0,
+            0x300, 0x300, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0xE6, 0xE6, 0x1, 0x1, 0xE6, 0xE6, 0xE6, 0xE6, 0x1, 0x1, 0x1, 0xE6, 0xE6, 0, 0, 0,
+            0, 0xE6, 0, 0, 0, 0x1, 0x1, 0xE6, 0xDC, 0xE6, 0x1, 0x1, 0xDC, 0xDC, 0xDC, 0xDC,
+            0xE6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0xB00, 0, 0, 0, 0xB00, 0xB00, 0, 0, 0, 0,
+            0, 0, 0x800, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0x800, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x100, 0x100, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x100, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x100, 0x100, 0x100,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0x100, 0, 0, 0, 0, 0x100, 0, 0, 0x100, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0x100, 0, 0x100, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0x100, 0, 0, 0x100, 0, 0, 0x100, 0, 0x100, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0x100, 0, 0x100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x100, 0x100, 0x100,
+            0x100, 0x100, 0, 0, 0x100, 0x100, 0, 0, 0x100, 0x100, 0, 0, 0, 0, 0, 0,
+            0x100, 0x100, 0, 0, 0x100, 0x100, 0, 0, 0x100, 0x100, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x100, 0x100, 0x100, 0x100,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0x100, 0x100, 0x100, 0x100, 0, 0, 0, 0, 0, 0, 0x100, 0x100, 0x100, 0x100, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0x300, 0x300, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x300, 0, 0, 0,
+            0x800, 0, 0x800, 0x800, 0x800, 0, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0x800, 0x800,
+            0x800, 0, 0x800, 0, 0, 0x800, 0, 0, 0, 0, 0, 0, 0, 0, 0x800, 0x800,
+            0x800, 0, 0x800, 0, 0, 0, 0, 0, 0, 0, 0, 0x800, 0, 0x800, 0, 0xE6,
+            0xE6, 0xE6, 0x800, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x9,
+            0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6,
+            0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xDA, 0xE4, 0xE8, 0xDE, 0xE0, 0xE0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x100, 0, 0x100, 0,
+            0x100, 0, 0x100, 0, 0x100, 0, 0x100, 0, 0x100, 0, 0x100, 0, 0x100, 0, 0x100, 0,
+            0x100, 0, 0x100, 0, 0, 0x100, 0, 0x100, 0, 0x100, 0, 0, 0, 0, 0, 0,
+            0x100, 0x100, 0, 0x100, 0x100, 0, 0x100, 0x100, 0, 0x100, 0x100, 0, 0x100, 0x100, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0x100, 0, 0, 0, 0, 0x408, 0x408, 0, 0, 0, 0x100, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0x100, 0, 0, 0x100, 0x100, 0x100, 0x100, 0, 0, 0, 0x100, 0,
+            0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0, 0xE6,
+            0, 0, 0, 0, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0, 0,
+            0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0,
+            0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0, 0, 0xE6, 0xE6,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0xE6, 0xE6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0,
+            0, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0,
+            0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0x800, 0, 0x800, 0, 0x800, 0x800, 0,
+            0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0, 0, 0, 0x800, 0, 0x800, 0, 0,
+            0x800, 0, 0x800, 0, 0, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0,
+            0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0x800, 0x800, 0x800, 0x800, 0,
+            0x800, 0x800, 0x800, 0x800, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0, 0x800, 0,
+            0x800, 0, 0x800, 0, 0x800, 0x800, 0x800, 0x800, 0, 0x800, 0, 0, 0, 0, 0, 0,
+            0x800, 0, 0, 0, 0, 0, 0x800, 0, 0x800, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0x9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x9, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0x9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6,
+            0xE6, 0xE6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xDC, 0xDC, 0xDC, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0x9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0x7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0x9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0xE6, 0, 0xE6, 0xE6, 0xDC, 0, 0, 0xE6, 0xE6, 0, 0, 0, 0, 0, 0xE6, 0xE6,
+            0, 0xE6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0x9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800,
+            0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+            0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+            0x100, 0x100, 0x100, 0x100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300,
+            0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300,
+            0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0, 0,
+            0x300, 0, 0x300, 0, 0, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0,
+            0x300, 0, 0x300, 0, 0, 0x300, 0x300, 0, 0, 0, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300,
+            0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300,
+            0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0, 0,
+            0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300,
+            0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300,
+            0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x300, 0x1A, 0x300,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300,
+            0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0, 0x300, 0x300, 0x300, 0x300, 0x300, 0, 0x300, 0,
+            0x300, 0x300, 0, 0x300, 0x300, 0, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xE6, 0xE6,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xDC, 0, 0,
+            0xDC, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0, 0, 0, 0, 0,
+            0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800,
+            0x800, 0x800, 0x800, 0x800, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0, 0x800, 0x800, 0x800, 0x800,
+            0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0, 0x800, 0x800, 0x800, 0x800,
+            0x800, 0x800, 0x800, 0, 0x800, 0x800, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xDC, 0, 0xE6,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0xE6, 0x1, 0xDC, 0, 0, 0, 0, 0x9,
+            0, 0, 0, 0, 0, 0xE6, 0xDC, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800, 0x800,
+            0x800, 0x800, 0x800, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0xE6, 0xE6, 0xE6, 0xE6, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xE6, 0xE6, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0xDC, 0xDC, 0xE6, 0xE6, 0xE6, 0xDC, 0xE6, 0xDC, 0xDC, 0xDC,
+            0xDC, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0xE6, 0xDC, 0xE6, 0xDC, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0x9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x9,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x100, 0, 0x100, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x100, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0x9, 0x407, 0, 0, 0, 0, 0,
+            0xE6, 0xE6, 0xE6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0x400, 0, 0, 0, 0, 0, 0, 0x100, 0x100,
+            0, 0, 0, 0x9, 0x9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0x9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x7, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0x9, 0x7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0x7, 0x9, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x7, 0x7, 0, 0x400, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x100, 0x100, 0x9, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0x400, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0, 0, 0,
+            0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0x9, 0, 0, 0, 0x7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xE6, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0x400, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x400, 0x100, 0x100, 0x400, 0x100, 0,
+            0, 0, 0x9, 0x7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x400,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x100, 0x100, 0, 0, 0, 0x9,
+            0x7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0x9, 0x7, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x9, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0x9, 0x7, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0x400, 0, 0, 0, 0, 0, 0, 0, 0x100, 0, 0, 0, 0, 0x9, 0x9, 0,
+            0, 0, 0, 0x7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0x9, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0x9, 0, 0, 0, 0, 0, 0,
+            0, 0, 0x7, 0, 0x9, 0x9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0x9, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0x1, 0x1, 0x1, 0x1, 0x1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0x6, 0x6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x1, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x300, 0x300,
+            0x300, 0x300, 0x300, 0x300, 0x300, 0xD8, 0xD8, 0x1, 0x1, 0x1, 0, 0, 0, 0xE2, 0xD8, 0xD8,
+            0xD8, 0xD8, 0xD8, 0, 0, 0, 0, 0, 0, 0, 0, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC,
+            0xDC, 0xDC, 0xDC, 0, 0, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xDC, 0xDC, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xE6, 0xE6, 0xE6, 0xE6, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x300, 0x300, 0x300, 0x300, 0x300,
+            0x300, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0xE6, 0xE6, 0xE6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6,
+            0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0, 0, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6,
+            0xE6, 0xE6, 0, 0xE6, 0xE6, 0, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xE6, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xE6, 0xE6, 0xE6, 0xE6,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0x800, 0x800, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0x7, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300,
+            0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0x300, 0, 0
+        };
+
+        constexpr std::array<std::uint64_t, 2061> decompositions = {
+            0x3000008200300U, 0x3040008200301U, 0x3080008200302U, 0x30C0008200303U,
+            0x3100008200308U, 0x314000820030AU, 0x31C0008600327U, 0x3200008A00300U,
+            0x3240008A00301U, 0x3280008A00302U, 0x32C0008A00308U, 0x3300009200300U,
+            0x3340009200301U, 0x3380009200302U, 0x33C0009200308U, 0x3440009C00303U,
+            0x3480009E00300U, 0x34C0009E00301U, 0x3500009E00302U, 0x3540009E00303U,
+            0x3580009E00308U, 0x364000AA00300U, 0x368000AA00301U, 0x36C000AA00302U,
+            0x370000AA00308U, 0x374000B200301U, 0x380000C200300U, 0x384000C200301U,
+            0x388000C200302U, 0x38C000C200303U, 0x390000C200308U, 0x394000C20030AU,
+            0x39C000C600327U, 0x3A0000CA00300U, 0x3A4000CA00301U, 0x3A8000CA00302U,
+            0x3AC000CA00308U, 0x3B0000D200300U, 0x3B4000D200301U, 0x3B8000D200302U,
+            0x3BC000D200308U, 0x3C4000DC00303U, 0x3C8000DE00300U, 0x3CC000DE00301U,
+            0x3D0000DE00302U, 0x3D4000DE00303U, 0x3D8000DE00308U, 0x3E4000EA00300U,
+            0x3E8000EA00301U, 0x3EC000EA00302U, 0x3F0000EA00308U, 0x3F4000F200301U,
+            0x3FC000F200308U, 0x4000008200304U, 0x404000C200304U, 0x4080008200306U,
+            0x40C000C200306U, 0x4100008200328U, 0x414000C200328U, 0x4180008600301U,
+            0x41C000C600301U, 0x4200008600302U, 0x424000C600302U, 0x4280008600307U,
+            0x42C000C600307U, 0x430000860030CU, 0x434000C60030CU, 0x438000880030CU,
+            0x43C000C80030CU, 0x4480008A00304U, 0x44C000CA00304U, 0x4500008A00306U,
+            0x454000CA00306U, 0x4580008A00307U, 0x45C000CA00307U, 0x4600008A00328U,
+            0x464000CA00328U, 0x4680008A0030CU, 0x46C000CA0030CU, 0x4700008E00302U,
+            0x474000CE00302U, 0x4780008E00306U, 0x47C000CE00306U, 0x4800008E00307U,
+            0x484000CE00307U, 0x4880008E00327U, 0x48C000CE00327U, 0x4900009000302U,
+            0x494000D000302U, 0x4A00009200303U, 0x4A4000D200303U, 0x4A80009200304U,
+            0x4AC000D200304U, 0x4B00009200306U, 0x4B4000D200306U, 0x4B80009200328U,
+            0x4BC000D200328U, 0x4C00009200307U, 0x4D00009400302U, 0x4D4000D400302U,
+            0x4D80009600327U, 0x4DC000D600327U, 0x4E40009800301U, 0x4E8000D800301U,
+            0x4EC0009800327U, 0x4F0000D800327U, 0x4F4000980030CU, 0x4F8000D80030CU,
+            0x50C0009C00301U, 0x510000DC00301U, 0x5140009C00327U, 0x518000DC00327U,
+            0x51C0009C0030CU, 0x520000DC0030CU, 0x5300009E00304U, 0x534000DE00304U,
+            0x5380009E00306U, 0x53C000DE00306U, 0x5400009E0030BU, 0x544000DE0030BU,
+            0x550000A400301U, 0x554000E400301U, 0x558000A400327U, 0x55C000E400327U,
+            0x560000A40030CU, 0x564000E40030CU, 0x568000A600301U, 0x56C000E600301U,
+            0x570000A600302U, 0x574000E600302U, 0x578000A600327U, 0x57C000E600327U,
+            0x580000A60030CU, 0x584000E60030CU, 0x588000A800327U, 0x58C000E800327U,
+            0x590000A80030CU, 0x594000E80030CU, 0x5A0000AA00303U, 0x5A4000EA00303U,
+            0x5A8000AA00304U, 0x5AC000EA00304U, 0x5B0000AA00306U, 0x5B4000EA00306U,
+            0x5B8000AA0030AU, 0x5BC000EA0030AU, 0x5C0000AA0030BU, 0x5C4000EA0030BU,
+            0x5C8000AA00328U, 0x5CC000EA00328U, 0x5D0000AE00302U, 0x5D4000EE00302U,
+            0x5D8000B200302U, 0x5DC000F200302U, 0x5E0000B200308U, 0x5E4000B400301U,
+            0x5E8000F400301U, 0x5EC000B400307U, 0x5F0000F400307U, 0x5F4000B40030CU,
+            0x5F8000F40030CU, 0x6800009E0031BU, 0x684000DE0031BU, 0x6BC000AA0031BU,
+            0x6C0000EA0031BU, 0x734000820030CU, 0x738000C20030CU, 0x73C000920030CU,
+            0x740000D20030CU, 0x7440009E0030CU, 0x748000DE0030CU, 0x74C000AA0030CU,
+            0x750000EA0030CU, 0x754001B800304U, 0x758001F800304U, 0x75C001B800301U,
+            0x760001F800301U, 0x764001B80030CU, 0x768001F80030CU, 0x76C001B800300U,
+            0x770001F800300U, 0x7780018800304U, 0x77C001C800304U, 0x7800044C00304U,
+            0x7840044E00304U, 0x7880018C00304U, 0x78C001CC00304U, 0x7980008E0030CU,
+            0x79C000CE0030CU, 0x7A0000960030CU, 0x7A4000D60030CU, 0x7A80009E00328U,
+            0x7AC000DE00328U, 0x7B0003D400304U, 0x7B4003D600304U, 0x7B80036E0030CU,
+            0x7BC005240030CU, 0x7C0000D40030CU, 0x7D00008E00301U, 0x7D4000CE00301U,
+            0x7E00009C00300U, 0x7E4000DC00300U, 0x7E80018A00301U, 0x7EC001CA00301U,
+            0x7F00018C00301U, 0x7F4001CC00301U, 0x7F8001B000301U, 0x7FC001F000301U,
+            0x800000820030FU, 0x804000C20030FU, 0x8080008200311U, 0x80C000C200311U,
+            0x8100008A0030FU, 0x814000CA0030FU, 0x8180008A00311U, 0x81C000CA00311U,
+            0x820000920030FU, 0x824000D20030FU, 0x8280009200311U, 0x82C000D200311U,
+            0x8300009E0030FU, 0x834000DE0030FU, 0x8380009E00311U, 0x83C000DE00311U,
+            0x840000A40030FU, 0x844000E40030FU, 0x848000A400311U, 0x84C000E400311U,
+            0x850000AA0030FU, 0x854000EA0030FU, 0x858000AA00311U, 0x85C000EA00311U,
+            0x860000A600326U, 0x864000E600326U, 0x868000A800326U, 0x86C000E800326U,
+            0x878000900030CU, 0x87C000D00030CU, 0x8980008200307U, 0x89C000C200307U,
+            0x8A00008A00327U, 0x8A4000CA00327U, 0x8A8001AC00304U, 0x8AC001EC00304U,
+            0x8B0001AA00304U, 0x8B4001EA00304U, 0x8B80009E00307U, 0x8BC000DE00307U,
+            0x8C00045C00304U, 0x8C40045E00304U, 0x8C8000B200304U, 0x8CC000F200304U,
+            0xD000060000000U, 0xD040060200000U, 0xD0C0062600000U, 0xD100061000301U,
+            0xDD00057200000U, 0xDF80007600000U, 0xE140015000301U, 0xE180072200301U,
+            0xE1C0016E00000U, 0xE200072A00301U, 0xE240072E00301U, 0xE280073200301U,
+            0xE300073E00301U, 0xE380074A00301U, 0xE3C0075200301U, 0xE400079400301U,
+            0xEA80073200308U, 0xEAC0074A00308U, 0xEB00076200301U, 0xEB40076A00301U,
+            0xEB80076E00301U, 0xEBC0077200301U, 0xEC00079600301U, 0xF280077200308U,
+            0xF2C0078A00308U, 0xF300077E00301U, 0xF340078A00301U, 0xF380079200301U,
+            0xF4C007A400301U, 0xF50007A400308U, 0x10000082A00300U, 0x10040082A00308U,
+            0x100C0082600301U, 0x101C0080C00308U, 0x10300083400301U, 0x10340083000300U,
+            0x10380084600306U, 0x10640083000306U, 0x10E40087000306U, 0x11400086A00300U,
+            0x11440086A00308U, 0x114C0086600301U, 0x115C008AC00308U, 0x11700087400301U,
+            0x11740087000300U, 0x11780088600306U, 0x11D8008E80030FU, 0x11DC008EA0030FU,
+            0x13040082C00306U, 0x13080086C00306U, 0x13400082000306U, 0x13440086000306U,
+            0x13480082000308U, 0x134C0086000308U, 0x13580082A00306U, 0x135C0086A00306U,
+            0x1368009B000308U, 0x136C009B200308U, 0x13700082C00308U, 0x13740086C00308U,
+            0x13780082E00308U, 0x137C0086E00308U, 0x13880083000304U, 0x138C0087000304U,
+            0x13900083000308U, 0x13940087000308U, 0x13980083C00308U, 0x139C0087C00308U,
+            0x13A8009D000308U, 0x13AC009D200308U, 0x13B00085A00308U, 0x13B40089A00308U,
+            0x13B80084600304U, 0x13BC0088600304U, 0x13C00084600308U, 0x13C40088600308U,
+            0x13C8008460030BU, 0x13CC008860030BU, 0x13D00084E00308U, 0x13D40088E00308U,
+            0x13E00085600308U, 0x13E40089600308U, 0x188800C4E00653U, 0x188C00C4E00654U,
+            0x189000C9000654U, 0x189400C4E00655U, 0x189800C9400654U, 0x1B0000DAA00654U,
+            0x1B0800D8200654U, 0x1B4C00DA400654U, 0x24A4012500093CU, 0x24C4012600093CU,
+            0x24D0012660093CU, 0x25600122A0093CU, 0x25640122C0093CU, 0x25680122E0093CU,
+            0x256C012380093CU, 0x2570012420093CU, 0x2574012440093CU, 0x2578012560093CU,
+            0x257C0125E0093CU, 0x272C0138E009BEU, 0x27300138E009D7U, 0x277001342009BCU,
+            0x277401344009BCU, 0x277C0135E009BCU, 0x28CC0146400A3CU, 0x28D80147000A3CU,
+            0x29640142C00A3CU, 0x29680142E00A3CU, 0x296C0143800A3CU, 0x29780145600A3CU,
+            0x2D200168E00B56U, 0x2D2C0168E00B3EU, 0x2D300168E00B57U, 0x2D700164200B3CU,
+            0x2D740164400B3CU, 0x2E500172400BD7U, 0x2F280178C00BBEU, 0x2F2C0178E00BBEU,
+            0x2F300178C00BD7U, 0x31200188C00C56U, 0x33000197E00CD5U, 0x331C0198C00CD5U,
+            0x33200198C00CD6U, 0x33280198C00CC2U, 0x332C0199400CD5U, 0x352801A8C00D3EU,
+            0x352C01A8E00D3EU, 0x353001A8C00D57U, 0x376801BB200DCAU, 0x377001BB200DCFU,
+            0x377401BB800DCAU, 0x377801BB200DDFU, 0x3D0C01E8400FB7U, 0x3D3401E9800FB7U,
+            0x3D4801EA200FB7U, 0x3D5C01EAC00FB7U, 0x3D7001EB600FB7U, 0x3DA401E8000FB5U,
+            0x3DCC01EE200F72U, 0x3DD401EE200F74U, 0x3DD801F6400F80U, 0x3DE001F6600F80U,
+            0x3E0401EE200F80U, 0x3E4C01F2400FB7U, 0x3E7401F3800FB7U, 0x3E8801F4200FB7U,
+            0x3E9C01F4C00FB7U, 0x3EB001F5600FB7U, 0x3EE401F2000FB5U, 0x40980204A0102EU,
+            0x6C180360A01B35U, 0x6C200360E01B35U, 0x6C280361201B35U, 0x6C300361601B35U,
+            0x6C380361A01B35U, 0x6C480362201B35U, 0x6CEC0367401B35U, 0x6CF40367801B35U,
+            0x6D000367C01B35U, 0x6D040367E01B35U, 0x6D0C0368401B35U, 0x78000008200325U,
+            0x7804000C200325U, 0x78080008400307U, 0x780C000C400307U, 0x78100008400323U,
+            0x7814000C400323U, 0x78180008400331U, 0x781C000C400331U, 0x78200018E00301U,
+            0x7824001CE00301U, 0x78280008800307U, 0x782C000C800307U, 0x78300008800323U,
+            0x7834000C800323U, 0x78380008800331U, 0x783C000C800331U, 0x78400008800327U,
+            0x7844000C800327U, 0x7848000880032DU, 0x784C000C80032DU, 0x78500022400300U,
+            0x78540022600300U, 0x78580022400301U, 0x785C0022600301U, 0x78600008A0032DU,
+            0x7864000CA0032DU, 0x78680008A00330U, 0x786C000CA00330U, 0x78700045000306U,
+            0x78740045200306U, 0x78780008C00307U, 0x787C000CC00307U, 0x78800008E00304U,
+            0x7884000CE00304U, 0x78880009000307U, 0x788C000D000307U, 0x78900009000323U,
+            0x7894000D000323U, 0x78980009000308U, 0x789C000D000308U, 0x78A00009000327U,
+            0x78A4000D000327U, 0x78A8000900032EU, 0x78AC000D00032EU, 0x78B00009200330U,
+            0x78B4000D200330U, 0x78B80019E00301U, 0x78BC001DE00301U, 0x78C00009600301U,
+            0x78C4000D600301U, 0x78C80009600323U, 0x78CC000D600323U, 0x78D00009600331U,
+            0x78D4000D600331U, 0x78D80009800323U, 0x78DC000D800323U, 0x78E003C6C00304U,
+            0x78E403C6E00304U, 0x78E80009800331U, 0x78EC000D800331U, 0x78F0000980032DU,
+            0x78F4000D80032DU, 0x78F80009A00301U, 0x78FC000DA00301U, 0x79000009A00307U,
+            0x7904000DA00307U, 0x79080009A00323U, 0x790C000DA00323U, 0x79100009C00307U,
+            0x7914000DC00307U, 0x79180009C00323U, 0x791C000DC00323U, 0x79200009C00331U,
+            0x7924000DC00331U, 0x79280009C0032DU, 0x792C000DC0032DU, 0x7930001AA00301U,
+            0x7934001EA00301U, 0x7938001AA00308U, 0x793C001EA00308U, 0x79400029800300U,
+            0x79440029A00300U, 0x79480029800301U, 0x794C0029A00301U, 0x7950000A000301U,
+            0x7954000E000301U, 0x7958000A000307U, 0x795C000E000307U, 0x7960000A400307U,
+            0x7964000E400307U, 0x7968000A400323U, 0x796C000E400323U, 0x797003CB400304U,
+            0x797403CB600304U, 0x7978000A400331U, 0x797C000E400331U, 0x7980000A600307U,
+            0x7984000E600307U, 0x7988000A600323U, 0x798C000E600323U, 0x7990002B400307U,
+            0x7994002B600307U, 0x7998002C000307U, 0x799C002C200307U, 0x79A003CC400307U,
+            0x79A403CC600307U, 0x79A8000A800307U, 0x79AC000E800307U, 0x79B0000A800323U,
+            0x79B4000E800323U, 0x79B8000A800331U, 0x79BC000E800331U, 0x79C0000A80032DU,
+            0x79C4000E80032DU, 0x79C8000AA00324U, 0x79CC000EA00324U, 0x79D0000AA00330U,
+            0x79D4000EA00330U, 0x79D8000AA0032DU, 0x79DC000EA0032DU, 0x79E0002D000301U,
+            0x79E4002D200301U, 0x79E8002D400308U, 0x79EC002D600308U, 0x79F0000AC00303U,
+            0x79F4000EC00303U, 0x79F8000AC00323U, 0x79FC000EC00323U, 0x7A00000AE00300U,
+            0x7A04000EE00300U, 0x7A08000AE00301U, 0x7A0C000EE00301U, 0x7A10000AE00308U,
+            0x7A14000EE00308U, 0x7A18000AE00307U, 0x7A1C000EE00307U, 0x7A20000AE00323U,
+            0x7A24000EE00323U, 0x7A28000B000307U, 0x7A2C000F000307U, 0x7A30000B000308U,
+            0x7A34000F000308U, 0x7A38000B200307U, 0x7A3C000F200307U, 0x7A40000B400302U,
+            0x7A44000F400302U, 0x7A48000B400323U, 0x7A4C000F400323U, 0x7A50000B400331U,
+            0x7A54000F400331U, 0x7A58000D000331U, 0x7A5C000E800308U, 0x7A60000EE0030AU,
+            0x7A64000F20030AU, 0x7A6C002FE00307U, 0x7A800008200323U, 0x7A84000C200323U,
+            0x7A880008200309U, 0x7A8C000C200309U, 0x7A900018400301U, 0x7A94001C400301U,
+            0x7A980018400300U, 0x7A9C001C400300U, 0x7AA00018400309U, 0x7AA4001C400309U,
+            0x7AA80018400303U, 0x7AAC001C400303U, 0x7AB003D4000302U, 0x7AB403D4200302U,
+            0x7AB80020400301U, 0x7ABC0020600301U, 0x7AC00020400300U, 0x7AC40020600300U,
+            0x7AC80020400309U, 0x7ACC0020600309U, 0x7AD00020400303U, 0x7AD40020600303U,
+            0x7AD803D4000306U, 0x7ADC03D4200306U, 0x7AE00008A00323U, 0x7AE4000CA00323U,
+            0x7AE80008A00309U, 0x7AEC000CA00309U, 0x7AF00008A00303U, 0x7AF4000CA00303U,
+            0x7AF80019400301U, 0x7AFC001D400301U, 0x7B000019400300U, 0x7B04001D400300U,
+            0x7B080019400309U, 0x7B0C001D400309U, 0x7B100019400303U, 0x7B14001D400303U,
+            0x7B1803D7000302U, 0x7B1C03D7200302U, 0x7B200009200309U, 0x7B24000D200309U,
+            0x7B280009200323U, 0x7B2C000D200323U, 0x7B300009E00323U, 0x7B34000DE00323U,
+            0x7B380009E00309U, 0x7B3C000DE00309U, 0x7B40001A800301U, 0x7B44001E800301U,
+            0x7B48001A800300U, 0x7B4C001E800300U, 0x7B50001A800309U, 0x7B54001E800309U,
+            0x7B58001A800303U, 0x7B5C001E800303U, 0x7B6003D9800302U, 0x7B6403D9A00302U,
+            0x7B680034000301U, 0x7B6C0034200301U, 0x7B700034000300U, 0x7B740034200300U,
+            0x7B780034000309U, 0x7B7C0034200309U, 0x7B800034000303U, 0x7B840034200303U,
+            0x7B880034000323U, 0x7B8C0034200323U, 0x7B90000AA00323U, 0x7B94000EA00323U,
+            0x7B98000AA00309U, 0x7B9C000EA00309U, 0x7BA00035E00301U, 0x7BA40036000301U,
+            0x7BA80035E00300U, 0x7BAC0036000300U, 0x7BB00035E00309U, 0x7BB40036000309U,
+            0x7BB80035E00303U, 0x7BBC0036000303U, 0x7BC00035E00323U, 0x7BC40036000323U,
+            0x7BC8000B200300U, 0x7BCC000F200300U, 0x7BD0000B200323U, 0x7BD4000F200323U,
+            0x7BD8000B200309U, 0x7BDC000F200309U, 0x7BE0000B200303U, 0x7BE4000F200303U,
+            0x7C000076200313U, 0x7C040076200314U, 0x7C0803E0000300U, 0x7C0C03E0200300U,
+            0x7C1003E0000301U, 0x7C1403E0200301U, 0x7C1803E0000342U, 0x7C1C03E0200342U,
+            0x7C200072200313U, 0x7C240072200314U, 0x7C2803E1000300U, 0x7C2C03E1200300U,
+            0x7C3003E1000301U, 0x7C3403E1200301U, 0x7C3803E1000342U, 0x7C3C03E1200342U,
+            0x7C400076A00313U, 0x7C440076A00314U, 0x7C4803E2000300U, 0x7C4C03E2200300U,
+            0x7C5003E2000301U, 0x7C5403E2200301U, 0x7C600072A00313U, 0x7C640072A00314U,
+            0x7C6803E3000300U, 0x7C6C03E3200300U, 0x7C7003E3000301U, 0x7C7403E3200301U,
+            0x7C800076E00313U, 0x7C840076E00314U, 0x7C8803E4000300U, 0x7C8C03E4200300U,
+            0x7C9003E4000301U, 0x7C9403E4200301U, 0x7C9803E4000342U, 0x7C9C03E4200342U,
+            0x7CA00072E00313U, 0x7CA40072E00314U, 0x7CA803E5000300U, 0x7CAC03E5200300U,
+            0x7CB003E5000301U, 0x7CB403E5200301U, 0x7CB803E5000342U, 0x7CBC03E5200342U,
+            0x7CC00077200313U, 0x7CC40077200314U, 0x7CC803E6000300U, 0x7CCC03E6200300U,
+            0x7CD003E6000301U, 0x7CD403E6200301U, 0x7CD803E6000342U, 0x7CDC03E6200342U,
+            0x7CE00073200313U, 0x7CE40073200314U, 0x7CE803E7000300U, 0x7CEC03E7200300U,
+            0x7CF003E7000301U, 0x7CF403E7200301U, 0x7CF803E7000342U, 0x7CFC03E7200342U,
+            0x7D000077E00313U, 0x7D040077E00314U, 0x7D0803E8000300U, 0x7D0C03E8200300U,
+            0x7D1003E8000301U, 0x7D1403E8200301U, 0x7D200073E00313U, 0x7D240073E00314U,
+            0x7D2803E9000300U, 0x7D2C03E9200300U, 0x7D3003E9000301U, 0x7D3403E9200301U,
+            0x7D400078A00313U, 0x7D440078A00314U, 0x7D4803EA000300U, 0x7D4C03EA200300U,
+            0x7D5003EA000301U, 0x7D5403EA200301U, 0x7D5803EA000342U, 0x7D5C03EA200342U,
+            0x7D640074A00314U, 0x7D6C03EB200300U, 0x7D7403EB200301U, 0x7D7C03EB200342U,
+            0x7D800079200313U, 0x7D840079200314U, 0x7D8803EC000300U, 0x7D8C03EC200300U,
+            0x7D9003EC000301U, 0x7D9403EC200301U, 0x7D9803EC000342U, 0x7D9C03EC200342U,
+            0x7DA00075200313U, 0x7DA40075200314U, 0x7DA803ED000300U, 0x7DAC03ED200300U,
+            0x7DB003ED000301U, 0x7DB403ED200301U, 0x7DB803ED000342U, 0x7DBC03ED200342U,
+            0x7DC00076200300U, 0x7DC40075800000U, 0x7DC80076A00300U, 0x7DCC0075A00000U,
+            0x7DD00076E00300U, 0x7DD40075C00000U, 0x7DD80077200300U, 0x7DDC0075E00000U,
+            0x7DE00077E00300U, 0x7DE40079800000U, 0x7DE80078A00300U, 0x7DEC0079A00000U,
+            0x7DF00079200300U, 0x7DF40079C00000U, 0x7E0003E0000345U, 0x7E0403E0200345U,
+            0x7E0803E0400345U, 0x7E0C03E0600345U, 0x7E1003E0800345U, 0x7E1403E0A00345U,
+            0x7E1803E0C00345U, 0x7E1C03E0E00345U, 0x7E2003E1000345U, 0x7E2403E1200345U,
+            0x7E2803E1400345U, 0x7E2C03E1600345U, 0x7E3003E1800345U, 0x7E3403E1A00345U,
+            0x7E3803E1C00345U, 0x7E3C03E1E00345U, 0x7E4003E4000345U, 0x7E4403E4200345U,
+            0x7E4803E4400345U, 0x7E4C03E4600345U, 0x7E5003E4800345U, 0x7E5403E4A00345U,
+            0x7E5803E4C00345U, 0x7E5C03E4E00345U, 0x7E6003E5000345U, 0x7E6403E5200345U,
+            0x7E6803E5400345U, 0x7E6C03E5600345U, 0x7E7003E5800345U, 0x7E7403E5A00345U,
+            0x7E7803E5C00345U, 0x7E7C03E5E00345U, 0x7E8003EC000345U, 0x7E8403EC200345U,
+            0x7E8803EC400345U, 0x7E8C03EC600345U, 0x7E9003EC800345U, 0x7E9403ECA00345U,
+            0x7E9803ECC00345U, 0x7E9C03ECE00345U, 0x7EA003ED000345U, 0x7EA403ED200345U,
+            0x7EA803ED400345U, 0x7EAC03ED600345U, 0x7EB003ED800345U, 0x7EB403EDA00345U,
+            0x7EB803EDC00345U, 0x7EBC03EDE00345U, 0x7EC00076200306U, 0x7EC40076200304U,
+            0x7EC803EE000345U, 0x7ECC0076200345U, 0x7ED00075800345U, 0x7ED80076200342U,
+            0x7EDC03F6C00345U, 0x7EE00072200306U, 0x7EE40072200304U, 0x7EE80072200300U,
+            0x7EEC0070C00000U, 0x7EF00072200345U, 0x7EF80077200000U, 0x7F040015000342U,
+            0x7F0803EE800345U, 0x7F0C0076E00345U, 0x7F100075C00345U, 0x7F180076E00342U,
+            0x7F1C03F8C00345U, 0x7F200072A00300U, 0x7F240071000000U, 0x7F280072E00300U,
+            0x7F2C0071200000U, 0x7F300072E00345U, 0x7F3403F7E00300U, 0x7F3803F7E00301U,
+            0x7F3C03F7E00342U, 0x7F400077200306U, 0x7F440077200304U, 0x7F480079400300U,
+            0x7F4C0072000000U, 0x7F580077200342U, 0x7F5C0079400342U, 0x7F600073200306U,
+            0x7F640073200304U, 0x7F680073200300U, 0x7F6C0071400000U, 0x7F7403FFC00300U,
+            0x7F7803FFC00301U, 0x7F7C03FFC00342U, 0x7F800078A00306U, 0x7F840078A00304U,
+            0x7F880079600300U, 0x7F8C0076000000U, 0x7F900078200313U, 0x7F940078200314U,
+            0x7F980078A00342U, 0x7F9C0079600342U, 0x7FA00074A00306U, 0x7FA40074A00304U,
+            0x7FA80074A00300U, 0x7FAC0071C00000U, 0x7FB00074200314U, 0x7FB40015000300U,
+            0x7FB80070A00000U, 0x7FBC000C000000U, 0x7FC803EF800345U, 0x7FCC0079200345U,
+            0x7FD00079C00345U, 0x7FD80079200342U, 0x7FDC03FEC00345U, 0x7FE00073E00300U,
+            0x7FE40071800000U, 0x7FE80075200300U, 0x7FEC0071E00000U, 0x7FF00075200345U,
+            0x7FF40016800000U, 0x80000400400000U, 0x80040400600000U, 0x84980075200000U,
+            0x84A80009600000U, 0x84AC0018A00000U, 0x86680432000338U, 0x866C0432400338U,
+            0x86B80432800338U, 0x8734043A000338U, 0x8738043A800338U, 0x873C043A400338U,
+            0x88100440600338U, 0x88240441000338U, 0x88300441600338U, 0x88900444600338U,
+            0x88980444A00338U, 0x89040447800338U, 0x89100448600338U, 0x891C0448A00338U,
+            0x89240449000338U, 0x89800007A00338U, 0x8988044C200338U, 0x89B40449A00338U,
+            0x89B80007800338U, 0x89BC0007C00338U, 0x89C0044C800338U, 0x89C4044CA00338U,
+            0x89D0044E400338U, 0x89D4044E600338U, 0x89E0044EC00338U, 0x89E4044EE00338U,
+            0x8A00044F400338U, 0x8A04044F600338U, 0x8A100450400338U, 0x8A140450600338U,
+            0x8A200450C00338U, 0x8A240450E00338U, 0x8AB00454400338U, 0x8AB40455000338U,
+            0x8AB80455200338U, 0x8ABC0455600338U, 0x8B80044F800338U, 0x8B84044FA00338U,
+            0x8B880452200338U, 0x8B8C0452400338U, 0x8BA80456400338U, 0x8BAC0456600338U,
+            0x8BB00456800338U, 0x8BB40456A00338U, 0x8CA40601000000U, 0x8CA80601200000U,
+            0xAB70055BA00338U, 0xC1300609603099U, 0xC1380609A03099U, 0xC1400609E03099U,
+            0xC148060A203099U, 0xC150060A603099U, 0xC158060AA03099U, 0xC160060AE03099U,
+            0xC168060B203099U, 0xC170060B603099U, 0xC178060BA03099U, 0xC180060BE03099U,
+            0xC188060C203099U, 0xC194060C803099U, 0xC19C060CC03099U, 0xC1A4060D003099U,
+            0xC1C0060DE03099U, 0xC1C4060DE0309AU, 0xC1CC060E403099U, 0xC1D0060E40309AU,
+            0xC1D8060EA03099U, 0xC1DC060EA0309AU, 0xC1E4060F003099U, 0xC1E8060F00309AU,
+            0xC1F0060F603099U, 0xC1F4060F60309AU, 0xC2500608C03099U, 0xC2780613A03099U,
+            0xC2B00615603099U, 0xC2B80615A03099U, 0xC2C00615E03099U, 0xC2C80616203099U,
+            0xC2D00616603099U, 0xC2D80616A03099U, 0xC2E00616E03099U, 0xC2E80617203099U,
+            0xC2F00617603099U, 0xC2F80617A03099U, 0xC3000617E03099U, 0xC3080618203099U,
+            0xC3140618803099U, 0xC31C0618C03099U, 0xC3240619003099U, 0xC3400619E03099U,
+            0xC3440619E0309AU, 0xC34C061A403099U, 0xC350061A40309AU, 0xC358061AA03099U,
+            0xC35C061AA0309AU, 0xC364061B003099U, 0xC368061B00309AU, 0xC370061B603099U,
+            0xC374061B60309AU, 0xC3D00614C03099U, 0xC3DC061DE03099U, 0xC3E0061E003099U,
+            0xC3E4061E203099U, 0xC3E8061E403099U, 0xC3F8061FA03099U, 0x3E4001189000000U,
+            0x3E4040CDE800000U, 0x3E40811D9400000U, 0x3E40C1199000000U, 0x3E4100DDA200000U,
+            0x3E41409C6400000U, 0x3E4180A7CA00000U, 0x3E41C13F3800000U, 0x3E42013F3800000U,
+            0x3E4240B2A200000U, 0x3E428123A200000U, 0x3E42C0AB0E00000U, 0x3E4300B29000000U,
+            0x3E4340C3EC00000U, 0x3E4380ECD200000U, 0x3E43C0FF0A00000U, 0x3E44010C7E00000U,
+            0x3E44410F7400000U, 0x3E448111F000000U, 0x3E44C1211E00000U, 0x3E4500D40400000U,
+            0x3E4540DA3600000U, 0x3E4580E1B200000U, 0x3E45C0E7BC00000U, 0x3E4601087A00000U,
+            0x3E464122D400000U, 0x3E468133E200000U, 0x3E46C09D0400000U, 0x3E4700A6EA00000U,
+            0x3E4740D60800000U, 0x3E4780E43600000U, 0x3E47C10C5A00000U, 0x3E48013C3C00000U,
+            0x3E4840BAA000000U, 0x3E4880DFD600000U, 0x3E48C10B9A00000U, 0x3E490112C800000U,
+            0x3E4940C59200000U, 0x3E498103B000000U, 0x3E49C1103E00000U, 0x3E4A00BD9400000U,
+            0x3E4A40CE2E00000U, 0x3E4A80DAD400000U, 0x3E4AC0E5F800000U, 0x3E4B01219C00000U,
+            0x3E4B409F0C00000U, 0x3E4B80A36E00000U, 0x3E4BC0A5BC00000U, 0x3E4C00C98800000U,
+            0x3E4C40D5A600000U, 0x3E4C80E42000000U, 0x3E4CC0EDCE00000U, 0x3E4D01000200000U,
+            0x3E4D410C0C00000U, 0x3E4D810CB800000U, 0x3E4DC11BDE00000U, 0x3E4E012E6400000U,
+            0x3E4E4136DE00000U, 0x3E4E813BF400000U, 0x3E4EC0F11800000U, 0x3E4F00F2FE00000U,
+            0x3E4F40FB4000000U, 0x3E4F81079200000U, 0x3E4FC1260800000U, 0x3E50013CFE00000U,
+            0x3E504115AC00000U, 0x3E5080B1BE00000U, 0x3E50C0BE0800000U, 0x3E5100F8C000000U,
+            0x3E514100FC00000U, 0x3E5180E4C400000U, 0x3E51C0F19400000U, 0x3E5201198400000U,
+            0x3E52412DEE00000U, 0x3E5280B1B000000U, 0x3E52C0B8C400000U, 0x3E5300D42600000U,
+            0x3E5340DBB400000U, 0x3E5380DE1E00000U, 0x3E53C0FA5E00000U, 0x3E5400FC6E00000U,
+            0x3E54412C9600000U, 0x3E5480A5A400000U, 0x3E54C1011600000U, 0x3E5500A3B800000U,
+            0x3E5540A39800000U, 0x3E5580F43800000U, 0x3E55C0FB7C00000U, 0x3E560107E200000U,
+            0x3E56412CEA00000U, 0x3E5681170000000U, 0x3E56C0C59E00000U, 0x3E5700D40400000U,
+            0x3E574115FC00000U, 0x3E57809C7200000U, 0x3E57C0B7CE00000U, 0x3E5800C02400000U,
+            0x3E5840E70E00000U, 0x3E5880EAE000000U, 0x3E58C0A62E00000U, 0x3E5900F1F600000U,
+            0x3E59409F7E00000U, 0x3E5980BF5200000U, 0x3E59C09C1A00000U, 0x3E5A00D99800000U,
+            0x3E5A40CAF000000U, 0x3E5A80FA4400000U, 0x3E5AC0A78600000U, 0x3E5B00B0BC00000U,
+            0x3E5B40EE0200000U, 0x3E5B81089200000U, 0x3E5BC1155400000U, 0x3E5C00D77400000U,
+            0x3E5C411F6000000U, 0x3E5C80D91000000U, 0x3E5CC0C5FC00000U, 0x3E5D0105CA00000U,
+            0x3E5D40C74000000U, 0x3E5D80EACA00000U, 0x3E5DC09D5C00000U, 0x3E5E00A2D200000U,
+            0x3E5E40A39200000U, 0x3E5E80D10200000U, 0x3E5EC0F9CE00000U, 0x3E5F0104DE00000U,
+            0x3E5F4115A400000U, 0x3E5F81239E00000U, 0x3E5FC0A5EA00000U, 0x3E6000A88400000U,
+            0x3E6040B2E600000U, 0x3E6080BDD800000U, 0x3E60C0CB8A00000U, 0x3E6100DFFC00000U,
+            0x3E6140F25400000U, 0x3E61812B5A00000U, 0x3E61C134D400000U, 0x3E62013D2E00000U,
+            0x3E62413D9C00000U, 0x3E6280A53600000U, 0x3E62C0CD8C00000U, 0x3E6300D6EE00000U,
+            0x3E63411EC400000U, 0x3E6380BCE800000U, 0x3E63C0C32000000U, 0x3E6400C40000000U,
+            0x3E6440C93400000U, 0x3E6480DE4600000U, 0x3E64C0E29200000U, 0x3E6500E91200000U,
+            0x3E6540F39400000U, 0x3E6580FBE800000U, 0x3E65C100DE00000U, 0x3E66011E4C00000U,
+            0x3E664109DC00000U, 0x3E6681204600000U, 0x3E66C1269400000U, 0x3E6700A42E00000U,
+            0x3E6740A54600000U, 0x3E6780A97A00000U, 0x3E67C0E19000000U, 0x3E6801118400000U,
+            0x3E6841155400000U, 0x3E6880BD9200000U, 0x3E68C0BFEA00000U, 0x3E6900C6F600000U,
+            0x3E6940D75C00000U, 0x3E6980F87C00000U, 0x3E69C0E6EA00000U, 0x3E6A009DC800000U,
+            0x3E6A40ADF200000U, 0x3E6A80B7CE00000U, 0x3E6AC0BB7400000U, 0x3E6B00C03800000U,
+            0x3E6B40E76400000U, 0x3E6B80E8D200000U, 0x3E6BC0FF3400000U, 0x3E6C01008C00000U,
+            0x3E6C41246800000U, 0x3E6C812DEC00000U, 0x3E6CC12E9000000U, 0x3E6D01303000000U,
+            0x3E6D409F1600000U, 0x3E6D80F35C00000U, 0x3E6DC1236800000U, 0x3E6E012D7000000U,
+            0x3E6E40C1C200000U, 0x3E6E809D0C00000U, 0x3E6EC0A1B400000U, 0x3E6F00B7DC00000U,
+            0x3E6F40B87E00000U, 0x3E6F80CB3200000U, 0x3E6FC0D40400000U, 0x3E7000E39C00000U,
+            0x3E7040EC8400000U, 0x3E708109F800000U, 0x3E70C120F800000U, 0x3E71013F1A00000U,
+            0x3E7140CD1000000U, 0x3E71812C5C00000U, 0x3E71C0A51200000U, 0x3E7200CEF600000U,
+            0x3E7240CFE600000U, 0x3E7280DA8200000U, 0x3E72C0DD3800000U, 0x3E7300E81200000U,
+            0x3E7340EAB200000U, 0x3E7380F0D600000U, 0x3E73C0FA2000000U, 0x3E740130BC00000U,
+            0x3E7440A2DA00000U, 0x3E7480C45C00000U, 0x3E74C12CF000000U, 0x3E7500A05600000U,
+            0x3E7540BA3200000U, 0x3E7580DBD400000U, 0x3E75C11E5400000U, 0x3E7600BF1600000U,
+            0x3E7640C28800000U, 0x3E7680D02E00000U, 0x3E76C0E70E00000U, 0x3E77012D0C00000U,
+            0x3E7740A45200000U, 0x3E7780A81E00000U, 0x3E77C0B8CA00000U, 0x3E7800CC2600000U,
+            0x3E7840CE9C00000U, 0x3E7880D15000000U, 0x3E78C0D9CA00000U, 0x3E7900E80C00000U,
+            0x3E7940EBC400000U, 0x3E7980FEF200000U, 0x3E79C1119E00000U, 0x3E7A0111C200000U,
+            0x3E7A41239800000U, 0x3E7A812DC400000U, 0x3E7AC0A67E00000U, 0x3E7B00DD7400000U,
+            0x3E7B40A83A00000U, 0x3E7B80E3A000000U, 0x3E7BC0E93000000U, 0x3E7C010BF400000U,
+            0x3E7C412D4600000U, 0x3E7C8138AE00000U, 0x3E7CC13D3E00000U, 0x3E7D00CF2E00000U,
+            0x3E7D40DB9600000U, 0x3E7D8103D000000U, 0x3E7DC0F59600000U, 0x3E7E00F64000000U,
+            0x3E7E40F92400000U, 0x3E7E80E58000000U, 0x3E7EC0E13200000U, 0x3E7F0116B000000U,
+            0x3E7F409D8000000U, 0x3E7F81066C00000U, 0x3E7FC0A47400000U, 0x3E8000A40E00000U,
+            0x3E8040BD4C00000U, 0x3E8080C5A600000U, 0x3E80C0F9AC00000U, 0x3E8100B70A00000U,
+            0x3E8140DA3C00000U, 0x3E8180CD6800000U, 0x3E81C11E7600000U, 0x3E8201109800000U,
+            0x3E82412C9A00000U, 0x3E8281131600000U, 0x3E82C0BDA600000U, 0x3E8300A28000000U,
+            0x3E8340AB8000000U, 0x3E8400B0B400000U, 0x3E8480CCE800000U, 0x3E8540A3BC00000U,
+            0x3E8580E65400000U, 0x3E85C0ED9400000U, 0x3E8600F27800000U, 0x3E8640F2BC00000U,
+            0x3E8680F2CA00000U, 0x3E86C0F31E00000U, 0x3E87012EAC00000U, 0x3E8740F97C00000U,
+            0x3E8780FF7A00000U, 0x3E88010C2400000U, 0x3E888115F000000U, 0x3E8941207000000U,
+            0x3E898121FA00000U, 0x3E8A8131DE00000U, 0x3E8AC131F800000U, 0x3E8B01325000000U,
+            0x3E8B413B6800000U, 0x3E8B8121BC00000U, 0x3E8BC12D6E00000U, 0x3E8C009F5C00000U,
+            0x3E8C40A1CE00000U, 0x3E8C80A29A00000U, 0x3E8CC0A59200000U, 0x3E8D00A5C800000U,
+            0x3E8D40A6A200000U, 0x3E8D80AB3A00000U, 0x3E8DC0AC0C00000U, 0x3E8E00ACD000000U,
+            0x3E8E40B08000000U, 0x3E8E80B15000000U, 0x3E8EC0B8C800000U, 0x3E8F00B8DC00000U,
+            0x3E8F40C12800000U, 0x3E8F80C2D000000U, 0x3E8FC0C31C00000U, 0x3E9000C3E400000U,
+            0x3E9040CA9E00000U, 0x3E9080CBC400000U, 0x3E90C0CD2200000U, 0x3E9100D10A00000U,
+            0x3E9140DAEE00000U, 0x3E9180DC3400000U, 0x3E91C0DE4400000U, 0x3E9200E2DC00000U,
+            0x3E9240E45600000U, 0x3E9280E84400000U, 0x3E92C0F12200000U, 0x3E9300F27C00000U,
+            0x3E9340F29200000U, 0x3E9380F29000000U, 0x3E93C0F2A000000U, 0x3E9400F2AC00000U,
+            0x3E9440F2BA00000U, 0x3E9480F31A00000U, 0x3E94C0F31C00000U, 0x3E9500F48000000U,
+            0x3E9540F50200000U, 0x3E9580F78000000U, 0x3E95C0FBE800000U, 0x3E9600FC1200000U,
+            0x3E9640FC8200000U, 0x3E9680FEE400000U, 0x3E96C1000A00000U, 0x3E970103DA00000U,
+            0x3E974104F200000U, 0x3E978104F200000U, 0x3E97C108AE00000U, 0x3E9801122000000U,
+            0x3E9841132C00000U, 0x3E9881160200000U, 0x3E98C1167200000U, 0x3E990119A600000U,
+            0x3E99411A1000000U, 0x3E99811F6C00000U, 0x3E99C1207000000U, 0x3E9A012DC600000U,
+            0x3E9A412FFE00000U, 0x3E9A81307600000U, 0x3E9AC0C0EA00000U, 0x3E9B0485DC00000U,
+            0x3E9B41043000000U, 0x3E9C009C4C00000U, 0x3E9C40A36A00000U, 0x3E9C80A2D000000U,
+            0x3E9CC09F0000000U, 0x3E9D00A28A00000U, 0x3E9D40A30000000U, 0x3E9D80A58E00000U,
+            0x3E9DC0A5F400000U, 0x3E9E00AB3A00000U, 0x3E9E40AAAA00000U, 0x3E9E80AB3200000U,
+            0x3E9EC0ABC400000U, 0x3E9F00B0B400000U, 0x3E9F40B16600000U, 0x3E9F80B28800000U,
+            0x3E9FC0B2A800000U, 0x3EA000B4C400000U, 0x3EA040B65000000U, 0x3EA080BDA400000U,
+            0x3EA0C0BDB200000U, 0x3EA100BED200000U, 0x3EA140BF5A00000U, 0x3EA180C1B000000U,
+            0x3EA1C0C29C00000U, 0x3EA200C21000000U, 0x3EA240C31C00000U, 0x3EA280C2C000000U,
+            0x3EA2C0C3E400000U, 0x3EA300C46800000U, 0x3EA340C78800000U, 0x3EA380C83800000U,
+            0x3EA3C0C8A400000U, 0x3EA400CAAC00000U, 0x3EA440CCE800000U, 0x3EA480CE2E00000U,
+            0x3EA4C0CE3600000U, 0x3EA500CEAC00000U, 0x3EA540D6F200000U, 0x3EA580D77400000U,
+            0x3EA5C0DA8200000U, 0x3EA600DDB600000U, 0x3EA640DD9600000U, 0x3EA680DE4400000U,
+            0x3EA6C0E03C00000U, 0x3EA700E2DC00000U, 0x3EA740EF4E00000U, 0x3EA780E46A00000U,
+            0x3EA7C0E55E00000U, 0x3EA800E65400000U, 0x3EA840E8E200000U, 0x3EA880EA0C00000U,
+            0x3EA8C0EA7600000U, 0x3EA900EC3A00000U, 0x3EA940EC3E00000U, 0x3EA980ED9400000U,
+            0x3EA9C0EDB600000U, 0x3EAA00EDE800000U, 0x3EAA40EE9400000U, 0x3EAA80EE8000000U,
+            0x3EAAC0F19800000U, 0x3EAB00F56200000U, 0x3EAB40F78000000U, 0x3EAB80F8F600000U,
+            0x3EABC0FAB600000U, 0x3EAC00FBE800000U, 0x3EAC40FE7C00000U, 0x3EAC81000A00000U,
+            0x3EACC106A400000U, 0x3EAD0107DE00000U, 0x3EAD410EF200000U, 0x3EAD81128200000U,
+            0x3EADC1130C00000U, 0x3EAE01132C00000U, 0x3EAE41157E00000U, 0x3EAE8115F000000U,
+            0x3EAEC1159600000U, 0x3EAF01160200000U, 0x3EAF4115FC00000U, 0x3EAF8115DA00000U,
+            0x3EAFC1167200000U, 0x3EB001171400000U, 0x3EB0411A1000000U, 0x3EB0811E7000000U,
+            0x3EB0C120E400000U, 0x3EB101233200000U, 0x3EB14124EC00000U, 0x3EB1812CF800000U,
+            0x3EB1C12DC600000U, 0x3EB2012EAC00000U, 0x3EB2412FB600000U, 0x3EB2812FFE00000U,
+            0x3EB2C1301600000U, 0x3EB301307600000U, 0x3EB341362400000U, 0x3EB3813F3800000U,
+            0x3EB3C4509400000U, 0x3EB404508800000U, 0x3EB44467AA00000U, 0x3EB480773A00000U,
+            0x3EB4C0803000000U, 0x3EB500807200000U, 0x3EB544A49200000U, 0x3EB584B9A000000U,
+            0x3EB5C4FDA600000U, 0x3EB6013E8600000U, 0x3EB6413F1C00000U, 0x3EC7400BB2005B4U,
+            0x3EC7C00BE4005B7U, 0x3ECA800BD2005C1U, 0x3ECAC00BD2005C2U, 0x3ECB01F692005C1U,
+            0x3ECB41F692005C2U, 0x3ECB800BA0005B7U, 0x3ECBC00BA0005B8U, 0x3ECC000BA0005BCU,
+            0x3ECC400BA2005BCU, 0x3ECC800BA4005BCU, 0x3ECCC00BA6005BCU, 0x3ECD000BA8005BCU,
+            0x3ECD400BAA005BCU, 0x3ECD800BAC005BCU, 0x3ECE000BB0005BCU, 0x3ECE400BB2005BCU,
+            0x3ECE800BB4005BCU, 0x3ECEC00BB6005BCU, 0x3ECF000BB8005BCU, 0x3ECF800BBC005BCU,
+            0x3ED0000BC0005BCU, 0x3ED0400BC2005BCU, 0x3ED0C00BC6005BCU, 0x3ED1000BC8005BCU,
+            0x3ED1800BCC005BCU, 0x3ED1C00BCE005BCU, 0x3ED2000BD0005BCU, 0x3ED2400BD2005BCU,
+            0x3ED2800BD4005BCU, 0x3ED2C00BAA005B9U, 0x3ED3000BA2005BFU, 0x3ED3400BB6005BFU,
+            0x3ED3800BC8005BFU, 0x4426822132110BAU, 0x4427022136110BAU, 0x442AC2214A110BAU,
+            0x444B82226211127U, 0x444BC2226411127U, 0x44D2C2268E1133EU, 0x44D302268E11357U,
+            0x452EC22972114BAU, 0x452F022972114B0U, 0x452F822972114BDU, 0x456E822B70115AFU,
+            0x456EC22B72115AFU, 0x464E02326A11930U, 0x745783A2AE1D165U, 0x7457C3A2B01D165U,
+            0x745803A2BE1D16EU, 0x745843A2BE1D16FU, 0x745883A2BE1D170U, 0x7458C3A2BE1D171U,
+            0x745903A2BE1D172U, 0x746EC3A3721D165U, 0x746F03A3741D165U, 0x746F43A3761D16EU,
+            0x746F83A3781D16EU, 0x746FC3A3761D16FU, 0x747003A3781D16FU, 0xBE00009C7A00000U,
+            0xBE00409C7000000U, 0xBE00809C8200000U, 0xBE00C4024400000U, 0xBE01009EC000000U,
+            0xBE01409F5C00000U, 0xBE01809F7600000U, 0xBE01C0A00400000U, 0xBE0200A0F400000U,
+            0xBE0240A13200000U, 0xBE0280A1CE00000U, 0xBE02C0A19E00000U, 0xBE0300693C00000U,
+            0xBE03440C7400000U, 0xBE0380A29A00000U, 0xBE03C0A2A800000U, 0xBE0400A2C800000U,
+            0xBE0440A2EE00000U, 0xBE04840A3800000U, 0xBE04C0697200000U, 0xBE0500A2CE00000U,
+            0xBE0540A31A00000U, 0xBE05840A9600000U, 0xBE05C0A32E00000U, 0xBE0600A34800000U,
+            0xBE06409D9800000U, 0xBE0680A35800000U, 0xBE06C0A36A00000U, 0xBE070523BE00000U,
+            0xBE0740A3EA00000U, 0xBE0780A40600000U, 0xBE07C069BE00000U, 0xBE0800A47600000U,
+            0xBE0840A48C00000U, 0xBE0880A4E400000U, 0xBE08C0A4EE00000U, 0xBE09006A2A00000U,
+            0xBE0940A58E00000U, 0xBE0980A59200000U, 0xBE09C0A5C800000U, 0xBE0A00A5F400000U,
+            0xBE0A40A60A00000U, 0xBE0A80A60C00000U, 0xBE0AC0A62E00000U, 0xBE0B00A69200000U,
+            0xBE0B40A6A200000U, 0xBE0B80A6B400000U, 0xBE0BC0A6E600000U, 0xBE0C00A6FA00000U,
+            0xBE0C40A6FE00000U, 0xBE0C80A6FE00000U, 0xBE0CC0A6FE00000U, 0xBE0D04145800000U,
+            0xBE0D40E0E000000U, 0xBE0D80A79400000U, 0xBE0DC0A7BE00000U, 0xBE0E0416C600000U,
+            0xBE0E40A7D600000U, 0xBE0E80A7E200000U, 0xBE0EC0A80C00000U, 0xBE0F00A93C00000U,
+            0xBE0F40A87000000U, 0xBE0F80A89000000U, 0xBE0FC0A8D000000U, 0xBE1000A94400000U,
+            0xBE1040A9EC00000U, 0xBE1080AA2000000U, 0xBE10C0AAA600000U, 0xBE1100AAC600000U,
+            0xBE1140AB0800000U, 0xBE1180AB0800000U, 0xBE11C0AB3200000U, 0xBE1200AB5600000U,
+            0xBE1240AB6600000U, 0xBE1280AB8400000U, 0xBE12C0AE2C00000U, 0xBE1300AC0C00000U,
+            0xBE1340AE2E00000U, 0xBE1380ACA200000U, 0xBE13C0ACE800000U, 0xBE1400A40E00000U,
+            0xBE1440B1DC00000U, 0xBE1480AF9C00000U, 0xBE14C0AFE800000U, 0xBE1500B01A00000U,
+            0xBE1540AF1600000U, 0xBE1580B06400000U, 0xBE15C0B06200000U, 0xBE1600B15800000U,
+            0xBE164429C800000U, 0xBE1680B1E400000U, 0xBE16C0B1EE00000U, 0xBE1700B20C00000U,
+            0xBE1740B23400000U, 0xBE1780B24400000U, 0xBE17C0B2C400000U, 0xBE18042D5000000U,
+            0xBE18442DD400000U, 0xBE1880B3D800000U, 0xBE18C0B43600000U, 0xBE1900B44E00000U,
+            0xBE1940B3B000000U, 0xBE1980B4CC00000U, 0xBE19C06DDC00000U, 0xBE1A006DF800000U,
+            0xBE1A40B61000000U, 0xBE1A80B67C00000U, 0xBE1AC0B67C00000U, 0xBE1B04339000000U,
+            0xBE1B40B78600000U, 0xBE1B80B7B000000U, 0xBE1BC0B7CE00000U, 0xBE1C00B7E600000U,
+            0xBE1C44363000000U, 0xBE1C80B7FE00000U, 0xBE1CC0B80C00000U, 0xBE1D00BEA600000U,
+            0xBE1D40B84400000U, 0xBE1D806F0200000U, 0xBE1DC0B8C000000U, 0xBE1E00B8DC00000U,
+            0xBE1E40B98000000U, 0xBE1E80B91A00000U, 0xBE1EC43BC800000U, 0xBE1F00BA8600000U,
+            0xBE1F443BCC00000U, 0xBE1F80BADC00000U, 0xBE1FC0BAD600000U, 0xBE2000BAF800000U,
+            0xBE2040BBC200000U, 0xBE2080BBC400000U, 0xBE20C0705E00000U, 0xBE2100BBFA00000U,
+            0xBE2140BC5000000U, 0xBE2180BC7A00000U, 0xBE21C0BCD200000U, 0xBE220070C400000U,
+            0xBE2244430600000U, 0xBE228070F800000U, 0xBE22C0BD6000000U, 0xBE2300BD6600000U,
+            0xBE2340BD6C00000U, 0xBE2380BD9400000U, 0xBE23C5472400000U, 0xBE2400BDFC00000U,
+            0xBE2444466200000U, 0xBE2484466200000U, 0xBE24C1040200000U, 0xBE2500BE4400000U,
+            0xBE2540BE4400000U, 0xBE2580718E00000U, 0xBE25C4657000000U, 0xBE2604C3B400000U,
+            0xBE2640BEC400000U, 0xBE2680BED600000U, 0xBE26C071C600000U, 0xBE2700BF3400000U,
+            0xBE2740BF9A00000U, 0xBE2780BFAE00000U, 0xBE27C0BFF200000U, 0xBE2800C10200000U,
+            0xBE2840727400000U, 0xBE2880723800000U, 0xBE28C0C12800000U, 0xBE29044DA800000U,
+            0xBE2940C18E00000U, 0xBE2980C29000000U, 0xBE29C0C29800000U, 0xBE2A00C29C00000U,
+            0xBE2A40C29800000U, 0xBE2A80C2F400000U, 0xBE2AC0C31C00000U, 0xBE2B00C36400000U,
+            0xBE2B40C34800000U, 0xBE2B80C35E00000U, 0xBE2BC0C3BC00000U, 0xBE2C00C3E400000U,
+            0xBE2C40C3EC00000U, 0xBE2C80C42000000U, 0xBE2CC0C43600000U, 0xBE2D00C4BA00000U,
+            0xBE2D40C56200000U, 0xBE2D80C5A800000U, 0xBE2DC0C6A000000U, 0xBE2E04561800000U,
+            0xBE2E40C67A00000U, 0xBE2E80C5F800000U, 0xBE2EC0C6D000000U, 0xBE2F00C70600000U,
+            0xBE2F40C7C800000U, 0xBE2F8457E200000U, 0xBE2FC0C84400000U, 0xBE3000C78A00000U,
+            0xBE3040C75200000U, 0xBE3080745C00000U, 0xBE30C0C8D200000U, 0xBE3100C8FC00000U,
+            0xBE3140C93A00000U, 0xBE3180C8EE00000U, 0xBE31C074D800000U, 0xBE3200CA9E00000U,
+            0xBE3240CAD800000U, 0xBE3284601400000U, 0xBE32C0CBC600000U, 0xBE3300CDF000000U,
+            0xBE3340CC9200000U, 0xBE3380763200000U, 0xBE33C0CD2200000U, 0xBE3400761000000U,
+            0xBE344075C800000U, 0xBE3480A32400000U, 0xBE34C0A32A00000U, 0xBE3500CE0000000U,
+            0xBE3540CD3800000U, 0xBE3581015A00000U, 0xBE35C087B200000U, 0xBE3600CE2E00000U,
+            0xBE3640CE3600000U, 0xBE3680CE4200000U, 0xBE36C0CEBC00000U, 0xBE3700CEA600000U,
+            0xBE3744678600000U, 0xBE3780769200000U, 0xBE37C0CFF400000U, 0xBE3800CF0A00000U,
+            0xBE3840D0A400000U, 0xBE3880D10A00000U, 0xBE38C468DA00000U, 0xBE3900D11C00000U,
+            0xBE3940D03E00000U, 0xBE3980D22800000U, 0xBE39C0773A00000U, 0xBE3A00D28400000U,
+            0xBE3A40D34600000U, 0xBE3A80D3D400000U, 0xBE3AC0D55000000U, 0xBE3B046D4600000U,
+            0xBE3B40D5B600000U, 0xBE3B80783000000U, 0xBE3BC0D64200000U, 0xBE3C04714E00000U,
+            0xBE3C40D6A800000U, 0xBE3C80789C00000U, 0xBE3CC0D6E400000U, 0xBE3D00D73E00000U,
+            0xBE3D40D77400000U, 0xBE3D80D77600000U, 0xBE3DC4751A00000U, 0xBE3E043A1600000U,
+            0xBE3E4475F400000U, 0xBE3E80D89C00000U, 0xBE3EC4797800000U, 0xBE3F00D97E00000U,
+            0xBE3F40D99A00000U, 0xBE3F80D8CE00000U, 0xBE3FC0DA2C00000U, 0xBE4000DA7C00000U,
+            0xBE4040DAEE00000U, 0xBE4080DA8200000U, 0xBE40C0DAD200000U, 0xBE4100DAF000000U,
+            0xBE4140DB0A00000U, 0xBE41847A3C00000U, 0xBE41C0DA6800000U, 0xBE4200DC5E00000U,
+            0xBE4240DCDC00000U, 0xBE42807A6600000U, 0xBE42C0DD9600000U, 0xBE4300DD8E00000U,
+            0xBE43447DA200000U, 0xBE4380DBF200000U, 0xBE43C0DEDC00000U, 0xBE44047EBC00000U,
+            0xBE44447F1C00000U, 0xBE4480DF8C00000U, 0xBE44C0E07200000U, 0xBE4500E03C00000U,
+            0xBE4540E03600000U, 0xBE45807B2C00000U, 0xBE45C0E09400000U, 0xBE4600E0FA00000U,
+            0xBE4640E0EE00000U, 0xBE4680E15A00000U, 0xBE46C40A4A00000U, 0xBE4700E28A00000U,
+            0xBE474484C600000U, 0xBE4780E33800000U, 0xBE47C4875600000U, 0xBE4800E45000000U,
+            0xBE4840E46A00000U, 0xBE4880E4A000000U, 0xBE48C48C1000000U, 0xBE4900E50000000U,
+            0xBE4940E52A00000U, 0xBE49848E6A00000U, 0xBE49C4902800000U, 0xBE4A00E6F400000U,
+            0xBE4A40E71600000U, 0xBE4A807D5800000U, 0xBE4AC0E74A00000U, 0xBE4B007D7000000U,
+            0xBE4B407D7000000U, 0xBE4B80E88E00000U, 0xBE4BC0E8B800000U, 0xBE4C00E8E200000U,
+            0xBE4C40E90A00000U, 0xBE4C80E99400000U, 0xBE4CC07E3600000U, 0xBE4D00EA4800000U,
+            0xBE4D44986C00000U, 0xBE4D80EA7C00000U, 0xBE4DC4992400000U, 0xBE4E00EAE000000U,
+            0xBE4E44433E00000U, 0xBE4E80EC2000000U, 0xBE4EC49F4200000U, 0xBE4F049F7000000U,
+            0xBE4F44A08800000U, 0xBE4F807FF800000U, 0xBE4FC0801000000U, 0xBE5000EDE800000U,
+            0xBE5044A1E600000U, 0xBE5084A1E400000U, 0xBE50C4A23200000U, 0xBE5104A26600000U,
+            0xBE5140EE3C00000U, 0xBE5180EE3E00000U, 0xBE51C0EE3E00000U, 0xBE5200EE9400000U,
+            0xBE5240807200000U, 0xBE5280EF1600000U, 0xBE52C0808C00000U, 0xBE5300812C00000U,
+            0xBE5344A83A00000U, 0xBE5380F09C00000U, 0xBE53C0F11800000U, 0xBE5400F19800000U,
+            0xBE544081C600000U, 0xBE5484AC4C00000U, 0xBE54C0F2AC00000U, 0xBE5504AD3400000U,
+            0xBE5544AD8A00000U, 0xBE5580F31E00000U, 0xBE55C0F3D600000U, 0xBE5600825E00000U,
+            0xBE5640F48000000U, 0xBE5680F49400000U, 0xBE56C0F49E00000U, 0xBE5704B2F800000U,
+            0xBE5744B54E00000U, 0xBE5784B54E00000U, 0xBE57C0F5DC00000U, 0xBE5800840400000U,
+            0xBE5844B75600000U, 0xBE5880F78C00000U, 0xBE58C0F79200000U, 0xBE5900844E00000U,
+            0xBE5944B90000000U, 0xBE5980F9A400000U, 0xBE59C0854000000U, 0xBE5A00F9D000000U,
+            0xBE5A40F9C600000U, 0xBE5A80FA0000000U, 0xBE5AC4BF0C00000U, 0xBE5B00FAC600000U,
+            0xBE5B40860200000U, 0xBE5B80FB8E00000U, 0xBE5BC0FC0400000U, 0xBE5C00FC8A00000U,
+            0xBE5C40866800000U, 0xBE5C84C45000000U, 0xBE5CC4C48E00000U, 0xBE5D0086B200000U,
+            0xBE5D44C5B200000U, 0xBE5D80FEF400000U, 0xBE5DC4C67C00000U, 0xBE5E00FF2A00000U,
+            0xBE5E40FFF400000U, 0xBE5E81000A00000U, 0xBE5EC4C9B400000U, 0xBE5F04CA4600000U,
+            0xBE5F4100C000000U, 0xBE5F84CB5000000U, 0xBE5FC100E000000U, 0xBE600466BE00000U,
+            0xBE604087AA00000U, 0xBE6081016400000U, 0xBE60C1020600000U, 0xBE6100881600000U,
+            0xBE6141027C00000U, 0xBE6180B56A00000U, 0xBE61C4CF4E00000U, 0xBE6204CF6A00000U,
+            0xBE6244672600000U, 0xBE6284673800000U, 0xBE62C1040200000U, 0xBE6301040800000U,
+            0xBE63411F3C00000U, 0xBE638088D600000U, 0xBE63C1052200000U, 0xBE6401051600000U,
+            0xBE6441053A00000U, 0xBE6480A56600000U, 0xBE64C1056200000U, 0xBE6501056600000U,
+            0xBE6541057A00000U, 0xBE658105CC00000U, 0xBE65C4D67800000U, 0xBE660105CA00000U,
+            0xBE6641063A00000U, 0xBE668106C600000U, 0xBE66C1075A00000U, 0xBE6701064600000U,
+            0xBE6741077A00000U, 0xBE678107CE00000U, 0xBE67C108AE00000U, 0xBE680106A600000U,
+            0xBE6841079400000U, 0xBE6881079800000U, 0xBE68C107B800000U, 0xBE6904D86C00000U,
+            0xBE6944DAD600000U, 0xBE6984D9AA00000U, 0xBE69C08A5600000U, 0xBE6A0109E200000U,
+            0xBE6A4109E600000U, 0xBE6A810A2C00000U, 0xBE6AC4E79400000U, 0xBE6B010AC800000U,
+            0xBE6B44DE5800000U, 0xBE6B808ABA00000U, 0xBE6BC08AC200000U, 0xBE6C04DF6200000U,
+            0xBE6C44E1A400000U, 0xBE6C808AD600000U, 0xBE6CC10CA000000U, 0xBE6D010CB800000U,
+            0xBE6D410CCE00000U, 0xBE6D810CD200000U, 0xBE6DC10D5200000U, 0xBE6E010D1000000U,
+            0xBE6E410E1C00000U, 0xBE6E810DC400000U, 0xBE6EC10EF200000U, 0xBE6F010E5000000U,
+            0xBE6F410ED600000U, 0xBE6F810F0C00000U, 0xBE6FC08BAE00000U, 0xBE70010FC200000U,
+            0xBE7041100200000U, 0xBE70808BF200000U, 0xBE70C110C000000U, 0xBE710110C600000U,
+            0xBE7144ECCE00000U, 0xBE718111AE00000U, 0xBE71C111BC00000U, 0xBE72008C6A00000U,
+            0xBE724111F400000U, 0xBE7280697600000U, 0xBE72C4F15C00000U, 0xBE7304F2CC00000U,
+            0xBE73408D7C00000U, 0xBE73808D8E00000U, 0xBE73C1154000000U, 0xBE740115DA00000U,
+            0xBE7441171400000U, 0xBE748118AA00000U, 0xBE74C4F95000000U, 0xBE7501195600000U,
+            0xBE7541198200000U, 0xBE75811A3600000U, 0xBE75C11AEE00000U, 0xBE7604FE5E00000U,
+            0xBE7644100800000U, 0xBE76811B9600000U, 0xBE76C11B7800000U, 0xBE77011BE000000U,
+            0xBE774411BC00000U, 0xBE77811DA800000U, 0xBE77C11E7000000U, 0xBE78050BA400000U,
+            0xBE78450BDA00000U, 0xBE7881212800000U, 0xBE78C121E200000U, 0xBE7901222200000U,
+            0xBE79450E5C00000U, 0xBE7981223600000U, 0xBE79C1247000000U, 0xBE7A0125AE00000U,
+            0xBE7A4125B000000U, 0xBE7A8124F800000U, 0xBE7AC127F200000U, 0xBE7B01282A00000U,
+            0xBE7B4517F400000U, 0xBE7B812B1600000U, 0xBE7BC0932A00000U, 0xBE7C012B6E00000U,
+            0xBE7C451AEE00000U, 0xBE7C8093CC00000U, 0xBE7CC12D8600000U, 0xBE7D00BB6400000U,
+            0xBE7D412E4600000U, 0xBE7D85228A00000U, 0xBE7DC5243400000U, 0xBE7E0094DC00000U,
+            0xBE7E4094EC00000U, 0xBE7E812FC000000U, 0xBE7EC5281400000U, 0xBE7F00956400000U,
+            0xBE7F45292C00000U, 0xBE7F81301600000U, 0xBE7FC1301600000U, 0xBE8001305200000U,
+            0xBE80452B6C00000U, 0xBE808131C400000U, 0xBE80C0966600000U, 0xBE8101325200000U,
+            0xBE8141334E00000U, 0xBE8181338400000U, 0xBE81C133FC00000U, 0xBE8200979C00000U,
+            0xBE8245366000000U, 0xBE8281362400000U, 0xBE82C1388000000U, 0xBE830139FA00000U,
+            0xBE8340999C00000U, 0xBE838099DA00000U, 0xBE83C13ACE00000U, 0xBE8405419C00000U,
+            0xBE844099F000000U, 0xBE8485420A00000U, 0xBE84C5441C00000U, 0xBE8505452200000U,
+            0xBE85413D7600000U, 0xBE85809AAC00000U, 0xBE85C13DF200000U, 0xBE86013DFC00000U,
+            0xBE86413E0A00000U, 0xBE86813E1E00000U, 0xBE86C13E2C00000U, 0xBE87013E7600000U,
+            0xBE87454C0000000U
+        };
+
+        constexpr std::array<std::uint16_t, 941> compositions = {
+            912, 909, 913, 0, 1, 2, 3, 53, 55, 238, 4, 572, 5, 165, 208, 210,
+            570, 415, 57, 417, 419, 421, 59, 61, 63, 65, 6, 425, 67, 427, 431, 433,
+            429, 7, 8, 9, 598, 69, 71, 73, 10, 596, 77, 212, 214, 594, 240, 75,
+            439, 441, 445, 198, 79, 447, 81, 83, 187, 85, 87, 449, 453, 236, 451, 455,
+            457, 11, 12, 13, 89, 91, 93, 97, 14, 610, 167, 216, 218, 612, 95, 459,
+            98, 463, 189, 465, 100, 467, 102, 106, 469, 104, 475, 473, 477, 479, 481, 200,
+            108, 15, 483, 112, 485, 110, 489, 487, 16, 17, 18, 19, 114, 116, 246, 20,
+            616, 118, 169, 220, 222, 161, 614, 191, 499, 501, 120, 503, 124, 224, 226, 505,
+            122, 509, 126, 128, 511, 132, 513, 232, 130, 521, 136, 523, 234, 134, 527, 525,
+            21, 22, 23, 138, 140, 142, 24, 640, 144, 146, 171, 228, 230, 163, 638, 529,
+            148, 533, 531, 539, 541, 543, 545, 150, 549, 547, 551, 553, 555, 652, 25, 152,
+            658, 250, 557, 154, 656, 654, 155, 559, 157, 159, 561, 563, 26, 27, 28, 29,
+            54, 56, 239, 30, 573, 31, 166, 209, 211, 571, 416, 58, 418, 420, 422, 60,
+            62, 64, 66, 32, 426, 68, 428, 432, 434, 430, 33, 34, 35, 599, 70, 72,
+            74, 36, 597, 78, 213, 215, 595, 241, 76, 440, 442, 446, 199, 80, 448, 82,
+            84, 188, 86, 88, 450, 454, 237, 452, 456, 458, 565, 37, 38, 39, 90, 92,
+            94, 40, 611, 168, 217, 219, 613, 96, 460, 99, 197, 464, 190, 466, 101, 468,
+            103, 107, 470, 105, 476, 474, 478, 480, 482, 201, 109, 41, 484, 113, 486, 111,
+            490, 488, 42, 43, 44, 45, 115, 117, 247, 46, 617, 119, 170, 221, 223, 162,
+            615, 192, 500, 502, 121, 504, 125, 225, 227, 506, 123, 510, 127, 129, 512, 133,
+            514, 233, 131, 522, 566, 137, 524, 235, 135, 528, 526, 47, 48, 49, 139, 141,
+            143, 50, 641, 145, 147, 172, 229, 231, 164, 639, 530, 149, 534, 532, 540, 542,
+            544, 546, 151, 550, 548, 567, 552, 554, 556, 653, 51, 153, 659, 251, 558, 52,
+            657, 568, 655, 156, 560, 158, 160, 562, 564, 875, 258, 835, 576, 574, 580, 578,
+            181, 202, 204, 185, 423, 602, 600, 606, 604, 461, 620, 618, 624, 622, 491, 244,
+            493, 242, 206, 179, 175, 173, 177, 577, 575, 581, 579, 182, 203, 205, 186, 424,
+            603, 601, 607, 605, 462, 621, 619, 625, 623, 492, 245, 494, 243, 207, 180, 176,
+            174, 178, 586, 584, 590, 588, 587, 585, 591, 589, 435, 437, 436, 438, 495, 497,
+            496, 498, 515, 516, 517, 518, 535, 536, 537, 538, 569, 630, 628, 634, 632, 636,
+            631, 629, 635, 633, 637, 644, 642, 648, 646, 650, 645, 643, 649, 647, 651, 195,
+            193, 194, 183, 184, 443, 444, 248, 249, 196, 831, 259, 830, 829, 668, 669, 833,
+            841, 261, 682, 683, 843, 262, 696, 697, 845, 857, 263, 856, 855, 268, 712, 713,
+            883, 264, 726, 727, 874, 872, 265, 871, 870, 269, 740, 885, 266, 752, 753, 887,
+            826, 838, 760, 270, 823, 822, 660, 661, 827, 825, 762, 271, 676, 677, 764, 272,
+            688, 689, 839, 837, 766, 273, 850, 849, 275, 704, 705, 853, 768, 277, 720, 721,
+            866, 867, 770, 278, 863, 862, 276, 732, 733, 868, 772, 279, 744, 745, 881, 879,
+            851, 267, 854, 864, 274, 869, 880, 280, 281, 285, 302, 304, 284, 282, 306, 283,
+            300, 310, 312, 287, 314, 289, 316, 286, 318, 324, 288, 326, 328, 330, 332, 322,
+            303, 305, 293, 291, 307, 292, 301, 311, 313, 296, 315, 290, 317, 295, 319, 325,
+            297, 327, 329, 331, 333, 323, 294, 298, 299, 308, 309, 320, 321, 334, 335, 337,
+            336, 338, 340, 341, 339, 342, 343, 344, 353, 354, 365, 364, 366, 369, 370, 372,
+            371, 373, 374, 377, 375, 376, 378, 379, 381, 380, 382, 383, 385, 384, 403, 404,
+            405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 471, 472, 507, 508, 519, 520,
+            582, 592, 583, 593, 608, 609, 626, 627, 662, 664, 666, 774, 663, 665, 667, 775,
+            776, 777, 778, 779, 780, 781, 670, 672, 674, 782, 671, 673, 675, 783, 784, 785,
+            786, 787, 788, 789, 678, 680, 679, 681, 684, 686, 685, 687, 690, 692, 694, 790,
+            691, 693, 695, 791, 792, 793, 794, 795, 796, 797, 698, 700, 702, 798, 699, 701,
+            703, 799, 800, 801, 802, 803, 804, 805, 706, 708, 710, 707, 709, 711, 714, 716,
+            718, 715, 717, 719, 722, 724, 723, 725, 728, 730, 729, 731, 734, 736, 738, 735,
+            737, 739, 741, 742, 743, 746, 748, 750, 806, 747, 749, 751, 807, 808, 809, 810,
+            811, 812, 813, 754, 756, 758, 814, 755, 757, 759, 815, 816, 817, 818, 819, 820,
+            821, 824, 836, 878, 828, 846, 847, 848, 840, 882, 859, 860, 861, 894, 895, 896,
+            897, 899, 898, 900, 901, 902, 903, 904, 905, 906, 907, 908, 911, 910, 914, 915,
+            916, 917, 918, 919, 920, 921, 930, 931, 922, 923, 924, 925, 932, 933, 926, 927,
+            928, 929, 934, 935, 936, 937, 966, 941, 942, 943, 944, 945, 946, 947, 948, 949,
+            950, 951, 952, 953, 954, 955, 956, 957, 958, 959, 960, 961, 962, 963, 964, 965,
+            967, 993, 968, 969, 970, 971, 972, 973, 974, 975, 976, 977, 978, 979, 980, 981,
+            982, 983, 984, 985, 986, 987, 988, 989, 990, 991, 992, 994, 995, 996, 997, 998,
+            1493, 1494, 1495, 1496, 1497, 1498, 1499, 1501, 1500, 1502, 1503, 1504, 1505
+        };
+
+        constexpr std::array<FoldRange, 202> foldRanges = {{
+            {0x41, 0x5A, 32, 1},
+            {0xB5, 0xB5, 775, 1},
+            {0xC0, 0xD6, 32, 1},
+            {0xD8, 0xDE, 32, 1},
+            {0x100, 0x12E, 1, 2},
+            {0x132, 0x136, 1, 2},
+            {0x139, 0x147, 1, 2},
+            {0x14A, 0x176, 1, 2},
+            {0x178, 0x178, -121, 1},
+            {0x179, 0x17D, 1, 2},
+            {0x17F, 0x17F, -268, 1},
+            {0x181, 0x181, 210, 1},
+            {0x182, 0x184, 1, 2},
+            {0x186, 0x186, 206, 1},
+            {0x187, 0x187, 1, 1},
+            {0x189, 0x18A, 205, 1},
+            {0x18B, 0x18B, 1, 1},
+            {0x18E, 0x18E, 79, 1},
+            {0x18F, 0x18F, 202, 1},
+            {0x190, 0x190, 203, 1},
+            {0x191, 0x191, 1, 1},
+            {0x193, 0x193, 205, 1},
+            {0x194, 0x194, 207, 1},
+            {0x196, 0x196, 211, 1},
+            {0x197, 0x197, 209, 1},
+            {0x198, 0x198, 1, 1},
+            {0x19C, 0x19C, 211, 1},
+            {0x19D, 0x19D, 213, 1},
+            {0x19F, 0x19F, 214, 1},
+            {0x1A0, 0x1A4, 1, 2},
+            {0x1A6, 0x1A6, 218, 1},
+            {0x1A7, 0x1A7, 1, 1},
+            {0x1A9, 0x1A9, 218, 1},
+            {0x1AC, 0x1AC, 1, 1},
+            {0x1AE, 0x1AE, 218, 1},
+            {0x1AF, 0x1AF, 1, 1},
+            {0x1B1, 0x1B2, 217, 1},
+            {0x1B3, 0x1B5, 1, 2},
+            {0x1B7, 0x1B7, 219, 1},
+            {0x1B8, 0x1B8, 1, 1},
+            {0x1BC, 0x1BC, 1, 1},
+            {0x1C4, 0x1C4, 2, 1},
+            {0x1C5, 0x1C5, 1, 1},
+            {0x1C7, 0x1C7, 2, 1},
+            {0x1C8, 0x1C8, 1, 1},
+            {0x1CA, 0x1CA, 2, 1},
+            {0x1CB, 0x1DB, 1, 2},
+            {0x1DE, 0x1EE, 1, 2},
+            {0x1F1, 0x1F1, 2, 1},
+            {0x1F2, 0x1F4, 1, 2},
+            {0x1F6, 0x1F6, -97, 1},
+            {0x1F7, 0x1F7, -56, 1},
+            {0x1F8, 0x21E, 1, 2},
+            {0x220, 0x220, -130, 1},
+            {0x222, 0x232, 1, 2},
+            {0x23A, 0x23A, 10795, 1},
+            {0x23B, 0x23B, 1, 1},
+            {0x23D, 0x23D, -163, 1},
+            {0x23E, 0x23E, 10792, 1},
+            {0x241, 0x241, 1, 1},
+            {0x243, 0x243, -195, 1},
+            {0x244, 0x244, 69, 1},
+            {0x245, 0x245, 71, 1},
+            {0x246, 0x24E, 1, 2},
+            {0x345, 0x345, 116, 1},
+            {0x370, 0x372, 1, 2},
+            {0x376, 0x376, 1, 1},
+            {0x37F, 0x37F, 116, 1},
+            {0x386, 0x386, 38, 1},
+            {0x388, 0x38A, 37, 1},
+            {0x38C, 0x38C, 64, 1},
+            {0x38E, 0x38F, 63, 1},
+            {0x391, 0x3A1, 32, 1},
+            {0x3A3, 0x3AB, 32, 1},
+            {0x3C2, 0x3C2, 1, 1},
+            {0x3CF, 0x3CF, 8, 1},
+            {0x3D0, 0x3D0, -30, 1},
+            {0x3D1, 0x3D1, -25, 1},
+            {0x3D5, 0x3D5, -15, 1},
+            {0x3D6, 0x3D6, -22, 1},
+            {0x3D8, 0x3EE, 1, 2},
+            {0x3F0, 0x3F0, -54, 1},
+            {0x3F1, 0x3F1, -48, 1},
+            {0x3F4, 0x3F4, -60, 1},
+            {0x3F5, 0x3F5, -64, 1},
+            {0x3F7, 0x3F7, 1, 1},
+            {0x3F9, 0x3F9, -7, 1},
+            {0x3FA, 0x3FA, 1, 1},
+            {0x3FD, 0x3FF, -130, 1},
+            {0x400, 0x40F, 80, 1},
+            {0x410, 0x42F, 32, 1},
+            {0x460, 0x480, 1, 2},
+            {0x48A, 0x4BE, 1, 2},
+            {0x4C0, 0x4C0, 15, 1},
+            {0x4C1, 0x4CD, 1, 2},
+            {0x4D0, 0x52E, 1, 2},
+            {0x531, 0x556, 48, 1},
+            {0x10A0, 0x10C5, 7264, 1},
+            {0x10C7, 0x10C7, 7264, 1},
+            {0x10CD, 0x10CD, 7264, 1},
+            {0x13F8, 0x13FD, -8, 1},
+            {0x1C80, 0x1C80, -6222, 1},
+            {0x1C81, 0x1C81, -6221, 1},
+            {0x1C82, 0x1C82, -6212, 1},
+            {0x1C83, 0x1C84, -6210, 1},
+            {0x1C85, 0x1C85, -6211, 1},
+            {0x1C86, 0x1C86, -6204, 1},
+            {0x1C87, 0x1C87, -6180, 1},
+            {0x1C88, 0x1C88, 35267, 1},
+            {0x1C90, 0x1CBA, -3008, 1},
+            {0x1CBD, 0x1CBF, -3008, 1},
+            {0x1E00, 0x1E94, 1, 2},
+            {0x1E9B, 0x1E9B, -58, 1},
+            {0x1E9E, 0x1E9E, -7615, 1},
+            {0x1EA0, 0x1EFE, 1, 2},
+            {0x1F08, 0x1F0F, -8, 1},
+            {0x1F18, 0x1F1D, -8, 1},
+            {0x1F28, 0x1F2F, -8, 1},
+            {0x1F38, 0x1F3F, -8, 1},
+            {0x1F48, 0x1F4D, -8, 1},
+            {0x1F59, 0x1F5F, -8, 2},
+            {0x1F68, 0x1F6F, -8, 1},
+            {0x1F88, 0x1F8F, -8, 1},
+            {0x1F98, 0x1F9F, -8, 1},
+            {0x1FA8, 0x1FAF, -8, 1},
+            {0x1FB8, 0x1FB9, -8, 1},
+            {0x1FBA, 0x1FBB, -74, 1},
+            {0x1FBC, 0x1FBC, -9, 1},
+            {0x1FBE, 0x1FBE, -7173, 1},
+            {0x1FC8, 0x1FCB, -86, 1},
+            {0x1FCC, 0x1FCC, -9, 1},
+            {0x1FD8, 0x1FD9, -8, 1},
+            {0x1FDA, 0x1FDB, -100, 1},
+            {0x1FE8, 0x1FE9, -8, 1},
+            {0x1FEA, 0x1FEB, -112, 1},
+            {0x1FEC, 0x1FEC, -7, 1},
+            {0x1FF8, 0x1FF9, -128, 1},
+            {0x1FFA, 0x1FFB, -126, 1},
+            {0x1FFC, 0x1FFC, -9, 1},
+            {0x2126, 0x2126, -7517, 1},
+            {0x212A, 0x212A, -8383, 1},
+            {0x212B, 0x212B, -8262, 1},
+            {0x2132, 0x2132, 28, 1},
+            {0x2160, 0x216F, 16, 1},
+            {0x2183, 0x2183, 1, 1},
+            {0x24B6, 0x24CF, 26, 1},
+            {0x2C00, 0x2C2F, 48, 1},
+            {0x2C60, 0x2C60, 1, 1},
+            {0x2C62, 0x2C62, -10743, 1},
+            {0x2C63, 0x2C63, -3814, 1},
+            {0x2C64, 0x2C64, -10727, 1},
+            {0x2C67, 0x2C6B, 1, 2},
+            {0x2C6D, 0x2C6D, -10780, 1},
+            {0x2C6E, 0x2C6E, -10749, 1},
+            {0x2C6F, 0x2C6F, -10783, 1},
+            {0x2C70, 0x2C70, -10782, 1},
+            {0x2C72, 0x2C72, 1, 1},
+            {0x2C75, 0x2C75, 1, 1},
+            {0x2C7E, 0x2C7F, -10815, 1},
+            {0x2C80, 0x2CE2, 1, 2},
+            {0x2CEB, 0x2CED, 1, 2},
+            {0x2CF2, 0x2CF2, 1, 1},
+            {0xA640, 0xA66C, 1, 2},
+            {0xA680, 0xA69A, 1, 2},
+            {0xA722, 0xA72E, 1, 2},
+            {0xA732, 0xA76E, 1, 2},
+            {0xA779, 0xA77B, 1, 2},
+            {0xA77D, 0xA77D, -35332, 1},
+            {0xA77E, 0xA786, 1, 2},
+            {0xA78B, 0xA78B, 1, 1},
+            {0xA78D, 0xA78D, -42280, 1},
+            {0xA790, 0xA792, 1, 2},
+            {0xA796, 0xA7A8, 1, 2},
+            {0xA7AA, 0xA7AA, -42308, 1},
+            {0xA7AB, 0xA7AB, -42319, 1},
+            {0xA7AC, 0xA7AC, -42315, 1},
+            {0xA7AD, 0xA7AD, -42305, 1},
+            {0xA7AE, 0xA7AE, -42308, 1},
+            {0xA7B0, 0xA7B0, -42258, 1},
+            {0xA7B1, 0xA7B1, -42282, 1},
+            {0xA7B2, 0xA7B2, -42261, 1},
+            {0xA7B3, 0xA7B3, 928, 1},
+            {0xA7B4, 0xA7C2, 1, 2},
+            {0xA7C4, 0xA7C4, -48, 1},
+            {0xA7C5, 0xA7C5, -42307, 1},
+            {0xA7C6, 0xA7C6, -35384, 1},
+            {0xA7C7, 0xA7C9, 1, 2},
+            {0xA7D0, 0xA7D0, 1, 1},
+            {0xA7D6, 0xA7D8, 1, 2},
+            {0xA7F5, 0xA7F5, 1, 1},
+            {0xAB70, 0xABBF, -38864, 1},
+            {0xFF21, 0xFF3A, 32, 1},
+            {0x10400, 0x10427, 40, 1},
+            {0x104B0, 0x104D3, 40, 1},
+            {0x10570, 0x1057A, 39, 1},
+            {0x1057C, 0x1058A, 39, 1},
+            {0x1058C, 0x10592, 39, 1},
+            {0x10594, 0x10595, 39, 1},
+            {0x10C80, 0x10CB2, 64, 1},
+            {0x118A0, 0x118BF, 32, 1},
+            {0x16E40, 0x16E5F, 32, 1},
+            {0x1E900, 0x1E921, 34, 1}
+        }};
+
+        constexpr char32_t hangulBase = 0xAC00;
+        constexpr char32_t hangulLeadBase = 0x1100;
+        constexpr char32_t hangulVowelBase = 0x1161;
+        constexpr char32_t hangulTrailBase = 0x11A7;
+        constexpr char32_t hangulLeadCount = 19;
+        constexpr char32_t hangulVowelCount = 21;
+        constexpr char32_t hangulTrailCount = 28;
+        constexpr char32_t hangulCount = hangulLeadCount * hangulVowelCount * hangulTrailCount;
+
+        constexpr std::uint16_t getProperties(const char32_t cp) noexcept
+        {
+            const std::size_t block = cp >> propertyShift;
+            return block < propertyIndex.size() ?
+                propertyBlocks[(static_cast<std::size_t>(propertyIndex[block]) << propertyShift) |
+                               (cp & ((1U << propertyShift) - 1))] : 0;
+        }
+
+        constexpr char32_t getFirst(const std::uint64_t decomposition) noexcept
+        {
+            return static_cast<char32_t>((decomposition >> 21) & 0x1FFFFF);
+        }
+
+        constexpr char32_t getSecond(const std::uint64_t decomposition) noexcept
+        {
+            return static_cast<char32_t>(decomposition & 0x1FFFFF);
+        }
+
+        // appends a code point, moving non-starters in front of the ones with a higher combining class
+        inline void appendOrdered(std::u32string& output, const char32_t cp)
+        {
+            const auto combiningClass = getProperties(cp) & combiningClassMask;
+            std::size_t i = output.size();
+            output.push_back(cp);
+
+            if (combiningClass)
+                for (; i && (getProperties(output[i - 1]) & combiningClassMask) > combiningClass; --i)
+                    std::swap(output[i - 1], output[i]);
+        }
+
+        inline void decompose(const char32_t cp, std::u32string& output)
         {
-            if (*i <= 0x7F)
-                result.push_back(static_cast<char>(*i));
-            else if (*i <= 0x7FF)
+            if (cp - hangulBase < hangulCount)
             {
-                result.push_back(static_cast<char>(0xC0 | ((*i >> 6) & 0x1F)));
-                result.push_back(static_cast<char>(0x80 | (*i & 0x3F)));
+                const char32_t index = cp - hangulBase;
+                output.push_back(hangulLeadBase + index / (hangulVowelCount * hangulTrailCount));
+                output.push_back(hangulVowelBase + index % (hangulVowelCount * hangulTrailCount) / hangulTrailCount);
+                if (index % hangulTrailCount) output.push_back(hangulTrailBase + index % hangulTrailCount);
             }
-            else if (*i <= 0xFFFF)
+            else if (getProperties(cp) & nfdNo)
             {
-                result.push_back(static_cast<char>(0xE0 | ((*i >> 12) & 0x0F)));
-                result.push_back(static_cast<char>(0x80 | ((*i >> 6) & 0x3F)));
-                result.push_back(static_cast<char>(0x80 | (*i & 0x3F)));
+                const auto i = std::lower_bound(decompositions.begin(), decompositions.end(),
+                                                static_cast<std::uint64_t>(cp) << 42);
+                decompose(getFirst(*i), output);
+                if (getSecond(*i)) decompose(getSecond(*i), output);
             }
             else
+                appendOrdered(output, cp);
+        }
+
+        // the primary composite of two code points, or zero if there is none
+        inline char32_t compose(const char32_t first, const char32_t second) noexcept
+        {
+            if (first - hangulLeadBase < hangulLeadCount && second - hangulVowelBase < hangulVowelCount)
+                return hangulBase + ((first - hangulLeadBase) * hangulVowelCount + second - hangulVowelBase) * hangulTrailCount;
+
+            if (first - hangulBase < hangulCount && (first - hangulBase) % hangulTrailCount == 0 &&
+                second - hangulTrailBase - 1 < hangulTrailCount - 1)
+                return first + second - hangulTrailBase;
+
+            // every code point that composes with a preceding one is a quick check maybe
+            if (!(getProperties(second) & nfcMaybe)) return 0;
+
+            const auto i = std::lower_bound(compositions.begin(), compositions.end(), std::make_pair(first, second),
+                                            [](const std::uint16_t index, const std::pair<char32_t, char32_t>& pair) noexcept {
+                                                const auto decomposition = decompositions[index];
+                                                return std::make_pair(getFirst(decomposition), getSecond(decomposition)) < pair;
+                                            });
+            return i != compositions.end() && getFirst(decompositions[*i]) == first && getSecond(decompositions[*i]) == second ?
+                static_cast<char32_t>(decompositions[*i] >> 42) : 0;
+        }
+
+        // canonical composition of decomposed and ordered code points (UAX #15)
+        inline void composeAll(std::u32string& text) noexcept
+        {
+            if (text.empty()) return;
+
+            std::size_t starter = 0;
+            // a leading non-starter blocks any composition
+            std::uint32_t lastClass = (getProperties(text[0]) & combiningClassMask) ? 256 : 0;
+            std::size_t o = 1;
+
+            for (std::size_t i = 1; i < text.size(); ++i)
+            {
+                const char32_t cp = text[i];
+                const std::uint32_t combiningClass = getProperties(cp) & combiningClassMask;
+
+                if (lastClass < combiningClass || lastClass == 0)
+                    if (const char32_t composite = compose(text[starter], cp))
+                    {
+                        text[starter] = composite;
+                        continue;
+                    }
+
+                if (combiningClass == 0) starter = o;
+                lastClass = combiningClass;
+                text[o++] = cp;
+            }
+
+            text.resize(o);
+        }
+
+        struct QuickCheck final
+        {
+            std::size_t position; // the last starter in front of the first code point that needs a closer look
+            bool maybe; // whether that code point only may make the text unnormalized
+        };
+
+        // position is the input length if the text is known to be normalized
+        inline QuickCheck quickCheck(const std::uint8_t* input, const std::size_t length, const NormalizationForm form)
+        {
+            const std::uint16_t no = form == NormalizationForm::nfc ? nfcNo : nfdNo;
+            const std::uint16_t maybe = form == NormalizationForm::nfc ? nfcMaybe : 0;
+
+            std::size_t starter = 0;
+            std::uint16_t lastClass = 0;
+
+            for (std::size_t i = 0; i != length;)
             {
-                result.push_back(static_cast<char>(0xF0 | ((*i >> 18) & 0x07)));
-                result.push_back(static_cast<char>(0x80 | ((*i >> 12) & 0x3F)));
-                result.push_back(static_cast<char>(0x80 | ((*i >> 6) & 0x3F)));
-                result.push_back(static_cast<char>(0x80 | (*i & 0x3F)));
+                if (input[i] <= 0x7F)
+                {
+                    // ASCII is normalized and made of starters, skip it 8 bytes at a time
+                    for (std::uint64_t word; length - i >= 8; i += 8)
+                    {
+                        std::memcpy(&word, input + i, sizeof(word));
+                        if (word & 0x8080808080808080U) break;
+                    }
+                    for (; i != length && input[i] <= 0x7F; ++i);
+
+                    starter = i - 1;
+                    lastClass = 0;
+                    continue;
+                }
+
+                auto p = input + i;
+                char32_t cp;
+                if (!decodeNext(p, input + length, cp))
+                    throw ParseError("Invalid UTF-8 string");
+
+                const std::uint16_t properties = getProperties(cp);
+                const std::uint16_t combiningClass = properties & combiningClassMask;
+                if ((combiningClass && lastClass > combiningClass) || (properties & no)) return {starter, false};
+                if (properties & maybe) return {starter, true};
+
+                if (!combiningClass) starter = i;
+                lastClass = combiningClass;
+                i = static_cast<std::size_t>(p - input);
             }
+
+            return {length, false};
         }
 
-        return result;
+        inline void normalizeTail(const std::uint8_t* input, const std::size_t length, const NormalizationForm form,
+                                  std::string& output)
+        {
+            std::u32string codePoints;
+            codePoints.reserve(length + length / 2);
+
+            for (auto i = input; i != input + length;)
+            {
+                char32_t cp;
+                if (!decodeNext(i, input + length, cp))
+                    throw ParseError("Invalid UTF-8 string");
+                decompose(cp, codePoints);
+            }
+
+            if (form == NormalizationForm::nfc)
+                composeAll(codePoints);
+
+            const std::size_t size = output.size();
+            output.resize(size + codePoints.size() * 4);
+            std::size_t o = size;
+            for (const char32_t cp : codePoints)
+                o += encodeUtf8(cp, &output[o]);
+            output.resize(o);
+        }
     }
 
-    template <typename T>
-    std::string fromUtf32(const T& text)
+    // checks whether the text is in the normalization form, returns without allocating unless there are
+    // code points that can only be checked by normalizing
+    inline bool isNormalized(const std::string_view text, const NormalizationForm form = NormalizationForm::nfc)
+    {
+        const auto input = reinterpret_cast<const std::uint8_t*>(text.data());
+        const QuickCheck result = quickCheck(input, text.size(), form);
+        if (result.position == text.size()) return true;
+        if (!result.maybe) return false;
+
+        std::string tail;
+        normalizeTail(input + result.position, text.size() - result.position, form, tail);
+        return tail == text.substr(result.position);
+    }
+
+    // normalizes the text, only the part after the last starter in front of the first code point
+    // that fails the quick check is decomposed and recomposed
+    inline std::string normalize(const std::string_view text, const NormalizationForm form = NormalizationForm::nfc)
+    {
+        const auto input = reinterpret_cast<const std::uint8_t*>(text.data());
+        const QuickCheck result = quickCheck(input, text.size(), form);
+
+        std::string output(text.substr(0, result.position));
+        if (result.position != text.size())
+            normalizeTail(input + result.position, text.size() - result.position, form, output);
+        return output;
+    }
+
+    // simple case folding, maps each code point to exactly one code point
+    inline char32_t foldCase(const char32_t cp) noexcept
+    {
+        if (cp <= 0x7F) return cp - U'A' < 26 ? cp + 32 : cp;
+        if (!(getProperties(cp) & hasFold)) return cp;
+
+        const auto range = std::upper_bound(foldRanges.begin(), foldRanges.end(), cp,
+                                            [](const char32_t c, const FoldRange& r) noexcept { return c < r.first; }) - 1;
+        return static_cast<char32_t>(static_cast<std::int32_t>(cp) + range->delta);
+    }
+
+    inline std::string foldCase(const std::string_view text)
     {
-        return fromUtf32(std::begin(text), std::end(text));
+        std::string result;
+        result.reserve(text.size());
+
+        const auto input = reinterpret_cast<const std::uint8_t*>(text.data());
+        for (std::size_t i = 0; i != text.size();)
+        {
+            if (input[i] <= 0x7F)
+            {
+                result.push_back(static_cast<char>(input[i] >= 'A' && input[i] <= 'Z' ? input[i] + 32 : input[i]));
+                ++i;
+                continue;
+            }
+
+            auto p = input + i;
+            char32_t cp;
+            if (!decodeNext(p, input + text.size(), cp))
+                throw ParseError("Invalid UTF-8 string");
+
+            char bytes[4];
+            result.append(bytes, encodeUtf8(foldCase(cp), bytes));
+            i = static_cast<std::size_t>(p - input);
+        }
+
+        return result;
     }
 }
 
@@ -5,9 +5,22 @@
 #ifndef UUID_HPP
 #define UUID_HPP
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
 #include <random>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include "hex.hpp"
+#include "md5.hpp"
+#include "sha1.hpp"
 
 namespace uuid
 {
@@ -21,127 +34,605 @@ namespace uuid
         std::uint8_t node[6];
     };
 
-    inline Uuid generate()
+    // a UUID as its big-endian halves, comparing the halves orders UUIDs like their strings
+    struct Value final
     {
-        static std::random_device rd;
-        static std::mt19937_64 mt(rd());
+        std::uint64_t high;
+        std::uint64_t low;
+    };
 
-        const std::uint64_t randomTime = mt();
+    constexpr bool operator==(const Value& lhs, const Value& rhs) noexcept
+    {
+        return lhs.high == rhs.high && lhs.low == rhs.low;
+    }
 
-        const std::uint32_t timeLow = ((randomTime >> 24) & 0x000000FFU) |
-            ((randomTime >> 8) & 0x0000FF00U) |
-            ((randomTime << 8) & 0x00FF0000U) |
-            ((randomTime << 24) & 0xFF000000U);
+    constexpr bool operator!=(const Value& lhs, const Value& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
 
-        const auto timeMid = static_cast<std::uint16_t>(((randomTime >> 40) & 0x00FFU) |
-                                                        ((randomTime >> 24) & 0xFF00U));
+    constexpr bool operator<(const Value& lhs, const Value& rhs) noexcept
+    {
+        return lhs.high < rhs.high || (lhs.high == rhs.high && lhs.low < rhs.low);
+    }
 
-        const auto timeHiAndVersion = static_cast<std::uint16_t>(((0x04 << 12) & 0xF000U) |
-                                                                 ((randomTime >> 56) & 0x00FFU) |
-                                                                 ((randomTime >> 40) & 0x0F00U));
+    constexpr bool operator>(const Value& lhs, const Value& rhs) noexcept
+    {
+        return rhs < lhs;
+    }
 
-        const auto clockSequence = static_cast<std::uint16_t>(mt() & 0x3FFFU); // 14-bit random
+    constexpr bool operator<=(const Value& lhs, const Value& rhs) noexcept
+    {
+        return !(rhs < lhs);
+    }
 
-        const auto clockSeqHiAndReserved = static_cast<std::uint8_t>(0x80U | // bit 6 and 7
-                                                                     ((clockSequence >> 8) & 0x3FU));
-        const auto clockSeqLow = static_cast<std::uint8_t>(clockSequence & 0xFFU);
+    constexpr bool operator>=(const Value& lhs, const Value& rhs) noexcept
+    {
+        return !(lhs < rhs);
+    }
+
+    class ParseError final: public std::logic_error
+    {
+    public:
+        explicit ParseError(const std::string& str): std::logic_error(str) {}
+        explicit ParseError(const char* str): std::logic_error(str) {}
+    };
 
-        const auto random = mt();
+    enum class Error
+    {
+        none,
+        invalidCharacter,
+        invalidLength
+    };
 
-        return {
-            timeLow,
-            timeMid,
-            timeHiAndVersion,
-            clockSeqHiAndReserved,
-            clockSeqLow,
+    struct ParseResult final
+    {
+        Error error;
+        std::size_t position; // offset of the offending character, or the length of the input
+    };
+
+    // the canonical form with dashes and the plain form of 32 hex digits
+    constexpr std::size_t stringLength = 36;
+    constexpr std::size_t hexLength = 32;
+
+    // namespace IDs for name-based UUIDs (RFC 4122, appendix C)
+    constexpr std::array<std::uint8_t, 16> dnsNamespace = {
+        0x6B, 0xA7, 0xB8, 0x10, 0x9D, 0xAD, 0x11, 0xD1, 0x80, 0xB4, 0x00, 0xC0, 0x4F, 0xD4, 0x30, 0xC8
+    };
+
+    constexpr std::array<std::uint8_t, 16> urlNamespace = {
+        0x6B, 0xA7, 0xB8, 0x11, 0x9D, 0xAD, 0x11, 0xD1, 0x80, 0xB4, 0x00, 0xC0, 0x4F, 0xD4, 0x30, 0xC8
+    };
+
+    constexpr std::array<std::uint8_t, 16> oidNamespace = {
+        0x6B, 0xA7, 0xB8, 0x12, 0x9D, 0xAD, 0x11, 0xD1, 0x80, 0xB4, 0x00, 0xC0, 0x4F, 0xD4, 0x30, 0xC8
+    };
+
+    constexpr std::array<std::uint8_t, 16> x500Namespace = {
+        0x6B, 0xA7, 0xB8, 0x14, 0x9D, 0xAD, 0x11, 0xD1, 0x80, 0xB4, 0x00, 0xC0, 0x4F, 0xD4, 0x30, 0xC8
+    };
+
+    // xoshiro256** by Blackman and Vigna: 32 bytes of state and a few cycles per 64-bit output,
+    // fast but not cryptographically secure
+    class Xoshiro256 final
+    {
+    public:
+        using result_type = std::uint64_t;
+
+        static constexpr result_type min() noexcept { return 0; }
+        static constexpr result_type max() noexcept { return ~result_type{0}; }
+
+        // expands the seed with SplitMix64, which never yields the all-zero state
+        explicit constexpr Xoshiro256(std::uint64_t seed) noexcept
+        {
+            for (auto& s : state)
             {
-                static_cast<std::uint8_t>(random >> 48),
-                static_cast<std::uint8_t>(random >> 40),
-                static_cast<std::uint8_t>(random >> 32),
-                static_cast<std::uint8_t>(random >> 24),
-                static_cast<std::uint8_t>(random >> 16),
-                static_cast<std::uint8_t>(random >> 0)
+                seed += 0x9E3779B97F4A7C15U;
+                std::uint64_t z = seed;
+                z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9U;
+                z = (z ^ (z >> 27)) * 0x94D049BB133111EBU;
+                s = z ^ (z >> 31);
             }
-        };
+        }
+
+        explicit Xoshiro256(std::seed_seq& seq)
+        {
+            std::uint32_t words[8];
+            seq.generate(std::begin(words), std::end(words));
+            for (std::size_t i = 0; i < 4; ++i)
+                state[i] = (static_cast<std::uint64_t>(words[i * 2]) << 32) | words[i * 2 + 1];
+
+            if (!(state[0] | state[1] | state[2] | state[3])) state[0] = 1;
+        }
+
+        constexpr result_type operator()() noexcept
+        {
+            const std::uint64_t result = rotateLeft(state[1] * 5, 7) * 9;
+            const std::uint64_t t = state[1] << 17;
+
+            state[2] ^= state[0];
+            state[3] ^= state[1];
+            state[1] ^= state[2];
+            state[0] ^= state[3];
+            state[2] ^= t;
+            state[3] = rotateLeft(state[3], 45);
+
+            return result;
+        }
+
+    private:
+        static constexpr std::uint64_t rotateLeft(const std::uint64_t x, const int k) noexcept
+        {
+            return (x << k) | (x >> (64 - k));
+        }
+
+        std::uint64_t state[4]{};
+    };
+
+    inline namespace detail
+    {
+        // every thread seeds its own engine from the OS on first use, so generation needs no locking
+        inline Xoshiro256& getEngine()
+        {
+            thread_local Xoshiro256 engine = [] {
+                std::random_device rd;
+                std::seed_seq seed{rd(), rd(), rd(), rd(), rd(), rd(), rd(), rd()};
+                return Xoshiro256{seed};
+            }();
+            return engine;
+        }
+
+        // 64 random bits from an engine with a 64-bit or a 32-bit range
+        template <class Engine>
+        std::uint64_t random64(Engine& engine)
+        {
+            constexpr auto range = Engine::max() - Engine::min();
+            static_assert(range == 0xFFFFFFFFFFFFFFFFU || range == 0xFFFFFFFFU,
+                          "The engine must produce 32 or 64 random bits");
+
+            if constexpr (range == 0xFFFFFFFFU)
+            {
+                const auto high = static_cast<std::uint64_t>(engine() - Engine::min());
+                return (high << 32) | static_cast<std::uint64_t>(engine() - Engine::min());
+            }
+            else
+                return static_cast<std::uint64_t>(engine() - Engine::min());
+        }
+
+        // the version in the first and variant 1 in the second half of the big-endian value
+        constexpr std::uint64_t versionMask = 0xFFFFFFFFFFFF0FFFU;
+        constexpr std::uint64_t version4 = 0x0000000000004000U;
+        constexpr std::uint64_t version6 = 0x0000000000006000U;
+        constexpr std::uint64_t version7 = 0x0000000000007000U;
+        constexpr std::uint64_t variantMask = 0x3FFFFFFFFFFFFFFFU;
+        constexpr std::uint64_t variant = 0x8000000000000000U;
+
+        inline void storeBigEndian(const std::uint64_t value, std::uint8_t* output) noexcept
+        {
+            for (std::size_t i = 0; i < 8; ++i)
+                output[i] = static_cast<std::uint8_t>(value >> (56 - i * 8));
+        }
+
+        inline Uuid makeUuid(const std::uint64_t high, const std::uint64_t low) noexcept
+        {
+            return {
+                static_cast<std::uint32_t>(high >> 32),
+                static_cast<std::uint16_t>(high >> 16),
+                static_cast<std::uint16_t>(high),
+                static_cast<std::uint8_t>(low >> 56),
+                static_cast<std::uint8_t>(low >> 48),
+                {
+                    static_cast<std::uint8_t>(low >> 40),
+                    static_cast<std::uint8_t>(low >> 32),
+                    static_cast<std::uint8_t>(low >> 24),
+                    static_cast<std::uint8_t>(low >> 16),
+                    static_cast<std::uint8_t>(low >> 8),
+                    static_cast<std::uint8_t>(low)
+                }
+            };
+        }
+
+        // returns a timestamp that is at least now and greater than any returned before in this process,
+        // if the clock does not advance (or goes back) the last value is incremented
+        inline std::uint64_t nextTimestamp(std::atomic<std::uint64_t>& last, const std::uint64_t now) noexcept
+        {
+            std::uint64_t previous = last.load(std::memory_order_relaxed);
+            std::uint64_t next;
+            do
+                next = now > previous ? now : previous + 1;
+            while (!last.compare_exchange_weak(previous, next, std::memory_order_relaxed));
+            return next;
+        }
+
+        // Unix time in milliseconds followed by a 12-bit counter, which carries into the milliseconds
+        // after 4096 UUIDs in the same millisecond
+        inline std::uint64_t nextUnixTimestamp() noexcept
+        {
+            static std::atomic<std::uint64_t> last{0};
+            const auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+            return nextTimestamp(last, static_cast<std::uint64_t>(now) << 12);
+        }
+
+        // 100-nanosecond intervals since the Gregorian calendar reform (1582-10-15)
+        inline std::uint64_t nextGregorianTimestamp() noexcept
+        {
+            static std::atomic<std::uint64_t> last{0};
+            constexpr std::uint64_t gregorianOffset = 0x01B21DD213814000U;
+            const auto now = std::chrono::duration_cast<std::chrono::duration<std::int64_t, std::ratio<1, 10000000>>>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+            return nextTimestamp(last, static_cast<std::uint64_t>(now) + gregorianOffset);
+        }
+
+        inline std::array<std::uint8_t, 16> toBytes(const Uuid& uuid) noexcept
+        {
+            return std::array<std::uint8_t, 16>{
+                static_cast<std::uint8_t>(uuid.timeLow >> 24),
+                static_cast<std::uint8_t>(uuid.timeLow >> 16),
+                static_cast<std::uint8_t>(uuid.timeLow >> 8),
+                static_cast<std::uint8_t>(uuid.timeLow),
+
+                static_cast<std::uint8_t>(uuid.timeMid >> 8),
+                static_cast<std::uint8_t>(uuid.timeMid),
+
+                static_cast<std::uint8_t>(uuid.timeHiAndVersion >> 8),
+                static_cast<std::uint8_t>(uuid.timeHiAndVersion),
+
+                uuid.clockSeqHiAndReserved,
+                uuid.clockSeqLow,
+
+                uuid.node[0],
+                uuid.node[1],
+                uuid.node[2],
+                uuid.node[3],
+                uuid.node[4],
+                uuid.node[5]
+            };
+        }
+
+        inline Value toValue(const Uuid& uuid) noexcept
+        {
+            return {
+                (static_cast<std::uint64_t>(uuid.timeLow) << 32) |
+                    (static_cast<std::uint64_t>(uuid.timeMid) << 16) | uuid.timeHiAndVersion,
+                (static_cast<std::uint64_t>(uuid.clockSeqHiAndReserved) << 56) |
+                    (static_cast<std::uint64_t>(uuid.clockSeqLow) << 48) |
+                    (static_cast<std::uint64_t>(uuid.node[0]) << 40) |
+                    (static_cast<std::uint64_t>(uuid.node[1]) << 32) |
+                    (static_cast<std::uint64_t>(uuid.node[2]) << 24) |
+                    (static_cast<std::uint64_t>(uuid.node[3]) << 16) |
+                    (static_cast<std::uint64_t>(uuid.node[4]) << 8) | uuid.node[5]
+            };
+        }
+
+        inline std::uint64_t loadBigEndian(const std::uint8_t* input) noexcept
+        {
+            std::uint64_t value = 0;
+            for (std::size_t i = 0; i < 8; ++i)
+                value = (value << 8) | input[i];
+            return value;
+        }
+
+        // the 32 digits are encoded in one go and then moved apart to make room for the dashes
+        inline void encodeString(const Value& value, char* output, const bool uppercase) noexcept
+        {
+            std::uint8_t bytes[16];
+            storeBigEndian(value.high, bytes);
+            storeBigEndian(value.low, bytes + 8);
+
+            char digits[hexLength];
+            hex::encode(bytes, sizeof(bytes), digits, uppercase);
+
+            std::memcpy(output, digits, 8);
+            output[8] = '-';
+            std::memcpy(output + 9, digits + 8, 4);
+            output[13] = '-';
+            std::memcpy(output + 14, digits + 12, 4);
+            output[18] = '-';
+            std::memcpy(output + 19, digits + 16, 4);
+            output[23] = '-';
+            std::memcpy(output + 24, digits + 20, 12);
+        }
+
+        inline std::string toString(const Uuid& uuid)
+        {
+            std::string result(stringLength, '\0');
+            encodeString(toValue(uuid), &result[0], false);
+            return result;
+        }
+
+        // the first 16 bytes of a digest with the version and variant bits set
+        template <std::size_t size>
+        Uuid fromDigest(const std::array<std::uint8_t, size>& digest, const std::uint8_t version) noexcept
+        {
+            return {
+                (static_cast<std::uint32_t>(digest[0]) << 24) | (static_cast<std::uint32_t>(digest[1]) << 16) |
+                    (static_cast<std::uint32_t>(digest[2]) << 8) | digest[3],
+                static_cast<std::uint16_t>((digest[4] << 8) | digest[5]),
+                static_cast<std::uint16_t>((version << 12) | ((digest[6] & 0x0F) << 8) | digest[7]),
+                static_cast<std::uint8_t>(0x80 | (digest[8] & 0x3F)),
+                digest[9],
+                {digest[10], digest[11], digest[12], digest[13], digest[14], digest[15]}
+            };
+        }
+
+        template <class T>
+        T convert(const Uuid& uuid)
+        {
+            if constexpr (std::is_same_v<T, Uuid>)
+                return uuid;
+            else if constexpr (std::is_same_v<T, Value>)
+                return toValue(uuid);
+            else if constexpr (std::is_same_v<T, std::array<std::uint8_t, 16>>)
+                return toBytes(uuid);
+            else
+            {
+                static_assert(std::is_same_v<T, std::string>, "UUIDs can be generated as Uuid, Value, byte arrays or strings");
+                return toString(uuid);
+            }
+        }
     }
 
-    template <class T> T generate();
+    inline bool operator==(const Uuid& lhs, const Uuid& rhs) noexcept
+    {
+        return toValue(lhs) == toValue(rhs);
+    }
 
-    template <>
-    std::array<std::uint8_t, 16> generate<std::array<std::uint8_t, 16>>()
+    inline bool operator!=(const Uuid& lhs, const Uuid& rhs) noexcept
     {
-        const Uuid uuid = generate();
+        return toValue(lhs) != toValue(rhs);
+    }
 
-        return std::array<std::uint8_t, 16>{
-            static_cast<std::uint8_t>(uuid.timeLow >> 24),
-            static_cast<std::uint8_t>(uuid.timeLow >> 16),
-            static_cast<std::uint8_t>(uuid.timeLow >> 8),
-            static_cast<std::uint8_t>(uuid.timeLow),
+    inline bool operator<(const Uuid& lhs, const Uuid& rhs) noexcept
+    {
+        return toValue(lhs) < toValue(rhs);
+    }
 
-            static_cast<std::uint8_t>(uuid.timeMid >> 8),
-            static_cast<std::uint8_t>(uuid.timeMid),
+    inline bool operator>(const Uuid& lhs, const Uuid& rhs) noexcept
+    {
+        return toValue(lhs) > toValue(rhs);
+    }
 
-            static_cast<std::uint8_t>(uuid.timeHiAndVersion >> 8),
-            static_cast<std::uint8_t>(uuid.timeHiAndVersion),
+    inline bool operator<=(const Uuid& lhs, const Uuid& rhs) noexcept
+    {
+        return toValue(lhs) <= toValue(rhs);
+    }
 
-            uuid.clockSeqHiAndReserved,
-            uuid.clockSeqLow,
+    inline bool operator>=(const Uuid& lhs, const Uuid& rhs) noexcept
+    {
+        return toValue(lhs) >= toValue(rhs);
+    }
 
-            uuid.node[0],
-            uuid.node[1],
-            uuid.node[2],
-            uuid.node[3],
-            uuid.node[4],
-            uuid.node[5]
-        };
+    // writes stringLength characters in the canonical form, returns the end of the output
+    inline char* toChars(const Value& value, char* output, const bool uppercase = false) noexcept
+    {
+        encodeString(value, output, uppercase);
+        return output + stringLength;
     }
 
-    template <>
-    std::string generate<std::string>()
-    {
-        constexpr char digits[] = "0123456789abcdef";
-
-        const Uuid uuid = generate();
-
-        return {
-            digits[(uuid.timeLow >> 28) & 0x0FU],
-            digits[(uuid.timeLow >> 24) & 0x0FU],
-            digits[(uuid.timeLow >> 20) & 0x0FU],
-            digits[(uuid.timeLow >> 16) & 0x0FU],
-            digits[(uuid.timeLow >> 12) & 0x0FU],
-            digits[(uuid.timeLow >> 8) & 0x0FU],
-            digits[(uuid.timeLow >> 4) & 0x0FU],
-            digits[(uuid.timeLow >> 0) & 0x0FU],
-            '-',
-            digits[(uuid.timeMid >> 12) & 0x0FU],
-            digits[(uuid.timeMid >> 8) & 0x0FU],
-            digits[(uuid.timeMid >> 4) & 0x0FU],
-            digits[(uuid.timeMid >> 0) & 0x0FU],
-            '-',
-            digits[(uuid.timeHiAndVersion >> 12) & 0x0FU],
-            digits[(uuid.timeHiAndVersion >> 8) & 0x0FU],
-            digits[(uuid.timeHiAndVersion >> 4) & 0x0FU],
-            digits[(uuid.timeHiAndVersion >> 0) & 0x0FU],
-            '-',
-            digits[(uuid.clockSeqHiAndReserved >> 4) & 0x0FU],
-            digits[(uuid.clockSeqHiAndReserved >> 0) & 0x0FU],
-            digits[(uuid.clockSeqLow >> 4) & 0x0FU],
-            digits[(uuid.clockSeqLow >> 0) & 0x0FU],
-            '-',
-            digits[(uuid.node[0] >> 4) & 0x0FU],
-            digits[(uuid.node[0] >> 0) & 0x0FU],
-            digits[(uuid.node[1] >> 4) & 0x0FU],
-            digits[(uuid.node[1] >> 0) & 0x0FU],
-            digits[(uuid.node[2] >> 4) & 0x0FU],
-            digits[(uuid.node[2] >> 0) & 0x0FU],
-            digits[(uuid.node[3] >> 4) & 0x0FU],
-            digits[(uuid.node[3] >> 0) & 0x0FU],
-            digits[(uuid.node[4] >> 4) & 0x0FU],
-            digits[(uuid.node[4] >> 0) & 0x0FU],
-            digits[(uuid.node[5] >> 4) & 0x0FU],
-            digits[(uuid.node[5] >> 0) & 0x0FU]
-        };
+    inline char* toChars(const Uuid& uuid, char* output, const bool uppercase = false) noexcept
+    {
+        return toChars(toValue(uuid), output, uppercase);
+    }
+
+    // accepts the canonical form and 32 hex digits in either case, the output is only written on success
+    inline ParseResult parse(const char* input, const std::size_t length, Value& output) noexcept
+    {
+        char compact[hexLength];
+        const char* digits = input;
+
+        if (length == stringLength)
+        {
+            for (const std::size_t dash : {8, 13, 18, 23})
+                if (input[dash] != '-') return {Error::invalidCharacter, dash};
+
+            std::memcpy(compact, input, 8);
+            std::memcpy(compact + 8, input + 9, 4);
+            std::memcpy(compact + 12, input + 14, 4);
+            std::memcpy(compact + 16, input + 19, 4);
+            std::memcpy(compact + 20, input + 24, 12);
+            digits = compact;
+        }
+        else if (length != hexLength)
+            return {Error::invalidLength, length};
+
+        // 32 digits are a single step of the vectorized hex decoder
+        std::uint8_t bytes[16];
+        const auto result = hex::decode(digits, hexLength, bytes, sizeof(bytes));
+        if (result.error != hex::Error::none)
+        {
+            std::size_t position = result.position;
+            if (digits == compact)
+                position += (position >= 8) + (position >= 12) + (position >= 16) + (position >= 20);
+            return {Error::invalidCharacter, position};
+        }
+
+        output = {loadBigEndian(bytes), loadBigEndian(bytes + 8)};
+        return {Error::none, length};
+    }
+
+    template <class T = Uuid>
+    T parse(const std::string_view s)
+    {
+        Value value;
+        const auto result = parse(s.data(), s.size(), value);
+        if (result.error == Error::invalidLength)
+            throw ParseError("Invalid UUID length");
+        else if (result.error != Error::none)
+            throw ParseError("Invalid UUID character");
+
+        if constexpr (std::is_same_v<T, Value>)
+            return value;
+        else
+            return convert<T>(makeUuid(value.high, value.low));
+    }
+
+    // a random (version 4) UUID from two 64-bit outputs of the engine
+    template <class Engine>
+    Uuid generate(Engine& engine)
+    {
+        const std::uint64_t high = (random64(engine) & versionMask) | version4;
+        const std::uint64_t low = (random64(engine) & variantMask) | variant;
+        return makeUuid(high, low);
+    }
+
+    inline Uuid generate()
+    {
+        return generate(getEngine());
+    }
+
+    template <class T, class Engine>
+    T generate(Engine& engine)
+    {
+        return convert<T>(generate(engine));
+    }
+
+    template <class T>
+    T generate()
+    {
+        return generate<T>(getEngine());
+    }
+
+    // a time-ordered (version 7) UUID: Unix time in milliseconds, a 12-bit counter and 62 random bits,
+    // UUIDs generated by one process are strictly increasing, also across threads
+    template <class Engine>
+    Uuid generateV7(Engine& engine)
+    {
+        const std::uint64_t timestamp = nextUnixTimestamp();
+        const std::uint64_t high = ((timestamp >> 12) << 16) | version7 | (timestamp & 0x0FFFU);
+        const std::uint64_t low = (random64(engine) & variantMask) | variant;
+        return makeUuid(high, low);
+    }
+
+    inline Uuid generateV7()
+    {
+        return generateV7(getEngine());
+    }
+
+    template <class T, class Engine>
+    T generateV7(Engine& engine)
+    {
+        return convert<T>(generateV7(engine));
+    }
+
+    template <class T>
+    T generateV7()
+    {
+        return generateV7<T>(getEngine());
+    }
+
+    // a reordered Gregorian time (version 6) UUID: the 60-bit timestamp in 100-nanosecond intervals from
+    // the most to the least significant bits, followed by a random clock sequence and node,
+    // strictly increasing within a process like version 7
+    template <class Engine>
+    Uuid generateV6(Engine& engine)
+    {
+        const std::uint64_t timestamp = nextGregorianTimestamp();
+        const std::uint64_t high = ((timestamp >> 12) << 16) | version6 | (timestamp & 0x0FFFU);
+        const std::uint64_t low = (random64(engine) & variantMask) | variant;
+        return makeUuid(high, low);
+    }
+
+    inline Uuid generateV6()
+    {
+        return generateV6(getEngine());
+    }
+
+    template <class T, class Engine>
+    T generateV6(Engine& engine)
+    {
+        return convert<T>(generateV6(engine));
+    }
+
+    template <class T>
+    T generateV6()
+    {
+        return generateV6<T>(getEngine());
+    }
+
+    // derives name-based UUIDs under one namespace, which is hashed only once,
+    // names convertible to std::string_view are hashed without a terminating zero
+    template <class Hasher, std::uint8_t version>
+    class BasicNameGenerator final
+    {
+    public:
+        explicit BasicNameGenerator(const std::array<std::uint8_t, 16>& namespaceId) noexcept
+        {
+            prefix.update(namespaceId);
+        }
+
+        template <class T = Uuid, class Name>
+        T generate(const Name& name) const
+        {
+            Hasher hasher = prefix;
+            if constexpr (std::is_convertible_v<const Name&, std::string_view>)
+                hasher.update(std::string_view{name});
+            else
+                hasher.update(name);
+
+            return convert<T>(fromDigest(hasher.finalize(), version));
+        }
+
+    private:
+        Hasher prefix;
+    };
+
+    using NameGeneratorV3 = BasicNameGenerator<md5::Hasher, 3>;
+    using NameGeneratorV5 = BasicNameGenerator<sha1::Hasher, 5>;
+
+    // a name-based UUID hashed with MD5 (version 3)
+    template <class T = Uuid, class Name>
+    T generateV3(const std::array<std::uint8_t, 16>& namespaceId, const Name& name)
+    {
+        return NameGeneratorV3{namespaceId}.generate<T>(name);
+    }
+
+    // a name-based UUID hashed with SHA-1 (version 5)
+    template <class T = Uuid, class Name>
+    T generateV5(const std::array<std::uint8_t, 16>& namespaceId, const Name& name)
+    {
+        return NameGeneratorV5{namespaceId}.generate<T>(name);
+    }
+
+    // fills the output with random UUIDs, two engine calls and two stores each
+    template <class Engine>
+    void generateN(std::array<std::uint8_t, 16>* output, const std::size_t count, Engine& engine)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            storeBigEndian((random64(engine) & versionMask) | version4, output[i].data());
+            storeBigEndian((random64(engine) & variantMask) | variant, output[i].data() + 8);
+        }
+    }
+
+    inline void generateN(std::array<std::uint8_t, 16>* output, const std::size_t count)
+    {
+        generateN(output, count, getEngine());
     }
 }
 
+namespace std
+{
+    // folds both halves so that time-ordered UUIDs, which share their high bits, still spread over the buckets
+    template <>
+    struct hash<uuid::Value>
+    {
+        size_t operator()(const uuid::Value& value) const noexcept
+        {
+            uint64_t h = (value.high ^ ((value.low << 32) | (value.low >> 32))) * 0x9E3779B97F4A7C15U;
+            h ^= h >> 32;
+            return static_cast<size_t>(h);
+        }
+    };
+
+    template <>
+    struct hash<uuid::Uuid>
+    {
+        size_t operator()(const uuid::Uuid& uuid) const noexcept
+        {
+            return hash<uuid::Value>{}(uuid::toValue(uuid));
+        }
+    };
+}
+
 #endif // UUID_HPP
@@ -0,0 +1,723 @@
+//
+// Header-only libs
+//
+
+#ifndef XXH3_HPP
+#define XXH3_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include "cpu.hpp"
+#if defined(_MSC_VER) && defined(_M_X64) && !defined(__clang__)
+#  include <intrin.h>
+#endif
+
+namespace xxh3
+{
+    struct Hash128 final
+    {
+        std::uint64_t low;
+        std::uint64_t high;
+
+        constexpr bool operator==(const Hash128& other) const noexcept
+        {
+            return low == other.low && high == other.high;
+        }
+
+        constexpr bool operator!=(const Hash128& other) const noexcept
+        {
+            return !(*this == other);
+        }
+    };
+
+    inline namespace detail
+    {
+        constexpr std::array<std::uint32_t, 3> primes32 = {
+            0x9E3779B1U, 0x85EBCA77U, 0xC2B2AE3DU
+        };
+
+        constexpr std::array<std::uint64_t, 5> primes64 = {
+            0x9E3779B185EBCA87ULL, 0xC2B2AE3D27D4EB4FULL, 0x165667B19E3779F9ULL,
+            0x85EBCA77C2B2AE63ULL, 0x27D4EB2F165667C5ULL
+        };
+
+        constexpr std::uint64_t primeMx1 = 0x165667919E3779F9ULL;
+        constexpr std::uint64_t primeMx2 = 0x9FB21C651E98DF25ULL;
+
+        constexpr std::size_t stripeLength = 64;
+        constexpr std::size_t secretConsumeRate = 8; // secret bytes skipped per stripe
+        constexpr std::size_t accumulatorCount = stripeLength / 8;
+        constexpr std::size_t secretSize = 192;
+        constexpr std::size_t stripesPerBlock = (secretSize - stripeLength) / secretConsumeRate;
+        constexpr std::size_t blockLength = stripeLength * stripesPerBlock;
+        constexpr std::size_t midSizeMax = 240; // longest input hashed without the accumulators
+        constexpr std::size_t midSizeStartOffset = 3;
+        constexpr std::size_t midSizeLastOffset = 17;
+        constexpr std::size_t secretSizeMin = 136;
+        constexpr std::size_t lastAccumulateStart = 7;
+        constexpr std::size_t mergeAccumulatorsStart = 11;
+        constexpr std::size_t bufferSize = 256;
+
+        template <class T, class = void>
+        struct IsContiguous: std::false_type {};
+
+        template <class T>
+        struct IsContiguous<T, std::void_t<decltype(std::data(std::declval<const T&>())),
+                                           decltype(std::size(std::declval<const T&>()))>>: std::true_type {};
+
+        using Secret = std::array<std::uint8_t, secretSize>;
+        using Accumulators = std::array<std::uint64_t, accumulatorCount>;
+
+        constexpr Secret defaultSecret = {
+            0xB8, 0xFE, 0x6C, 0x39, 0x23, 0xA4, 0x4B, 0xBE, 0x7C, 0x01, 0x81, 0x2C, 0xF7, 0x21, 0xAD, 0x1C,
+            0xDE, 0xD4, 0x6D, 0xE9, 0x83, 0x90, 0x97, 0xDB, 0x72, 0x40, 0xA4, 0xA4, 0xB7, 0xB3, 0x67, 0x1F,
+            0xCB, 0x79, 0xE6, 0x4E, 0xCC, 0xC0, 0xE5, 0x78, 0x82, 0x5A, 0xD0, 0x7D, 0xCC, 0xFF, 0x72, 0x21,
+            0xB8, 0x08, 0x46, 0x74, 0xF7, 0x43, 0x24, 0x8E, 0xE0, 0x35, 0x90, 0xE6, 0x81, 0x3A, 0x26, 0x4C,
+            0x3C, 0x28, 0x52, 0xBB, 0x91, 0xC3, 0x00, 0xCB, 0x88, 0xD0, 0x65, 0x8B, 0x1B, 0x53, 0x2E, 0xA3,
+            0x71, 0x64, 0x48, 0x97, 0xA2, 0x0D, 0xF9, 0x4E, 0x38, 0x19, 0xEF, 0x46, 0xA9, 0xDE, 0xAC, 0xD8,
+            0xA8, 0xFA, 0x76, 0x3F, 0xE3, 0x9C, 0x34, 0x3F, 0xF9, 0xDC, 0xBB, 0xC7, 0xC7, 0x0B, 0x4F, 0x1D,
+            0x8A, 0x51, 0xE0, 0x4B, 0xCD, 0xB4, 0x59, 0x31, 0xC8, 0x9F, 0x7E, 0xC9, 0xD9, 0x78, 0x73, 0x64,
+            0xEA, 0xC5, 0xAC, 0x83, 0x34, 0xD3, 0xEB, 0xC3, 0xC5, 0x81, 0xA0, 0xFF, 0xFA, 0x13, 0x63, 0xEB,
+            0x17, 0x0D, 0xDD, 0x51, 0xB7, 0xF0, 0xDA, 0x49, 0xD3, 0x16, 0x55, 0x26, 0x29, 0xD4, 0x68, 0x9E,
+            0x2B, 0x16, 0xBE, 0x58, 0x7D, 0x47, 0xA1, 0xFC, 0x8F, 0xF8, 0xB8, 0xD1, 0x7A, 0xD0, 0x31, 0xCE,
+            0x45, 0xCB, 0x3A, 0x8F, 0x95, 0x16, 0x04, 0x28, 0xAF, 0xD7, 0xFB, 0xCA, 0xBB, 0x4B, 0x40, 0x7E
+        };
+
+        constexpr Accumulators initialAccumulators = {
+            primes32[2], primes64[0], primes64[1], primes64[2],
+            primes64[3], primes32[1], primes64[4], primes32[0]
+        };
+
+        inline std::uint32_t read32(const std::uint8_t* p) noexcept
+        {
+            return static_cast<std::uint32_t>(p[0]) |
+                (static_cast<std::uint32_t>(p[1]) << 8) |
+                (static_cast<std::uint32_t>(p[2]) << 16) |
+                (static_cast<std::uint32_t>(p[3]) << 24);
+        }
+
+        inline std::uint64_t read64(const std::uint8_t* p) noexcept
+        {
+            return static_cast<std::uint64_t>(read32(p)) |
+                (static_cast<std::uint64_t>(read32(p + 4)) << 32);
+        }
+
+        inline void write64(std::uint8_t* p, const std::uint64_t value) noexcept
+        {
+            for (std::size_t i = 0; i < 8; ++i)
+                p[i] = static_cast<std::uint8_t>(value >> (i * 8));
+        }
+
+        constexpr std::uint32_t swap32(const std::uint32_t value) noexcept
+        {
+            return ((value << 24) & 0xFF000000U) |
+                ((value << 8) & 0x00FF0000U) |
+                ((value >> 8) & 0x0000FF00U) |
+                ((value >> 24) & 0x000000FFU);
+        }
+
+        constexpr std::uint64_t swap64(const std::uint64_t value) noexcept
+        {
+            return (static_cast<std::uint64_t>(swap32(static_cast<std::uint32_t>(value))) << 32) |
+                swap32(static_cast<std::uint32_t>(value >> 32));
+        }
+
+        constexpr std::uint32_t rotateLeft32(const std::uint32_t value,
+                                             const std::uint32_t bits) noexcept
+        {
+            return (value << bits) | (value >> (32 - bits));
+        }
+
+        constexpr std::uint64_t rotateLeft64(const std::uint64_t value,
+                                             const std::uint32_t bits) noexcept
+        {
+            return (value << bits) | (value >> (64 - bits));
+        }
+
+        // full 64x64->128-bit product
+        inline Hash128 multiply(const std::uint64_t a, const std::uint64_t b) noexcept
+        {
+#if defined(__SIZEOF_INT128__)
+            const auto product = static_cast<unsigned __int128>(a) * b;
+            return {static_cast<std::uint64_t>(product), static_cast<std::uint64_t>(product >> 64)};
+#elif defined(_MSC_VER) && defined(_M_X64) && !defined(__clang__)
+            std::uint64_t high;
+            const std::uint64_t low = _umul128(a, b, &high);
+            return {low, high};
+#else
+            const std::uint64_t loLo = (a & 0xFFFFFFFFU) * (b & 0xFFFFFFFFU);
+            const std::uint64_t hiLo = (a >> 32) * (b & 0xFFFFFFFFU);
+            const std::uint64_t loHi = (a & 0xFFFFFFFFU) * (b >> 32);
+            const std::uint64_t hiHi = (a >> 32) * (b >> 32);
+            const std::uint64_t cross = (loLo >> 32) + (hiLo & 0xFFFFFFFFU) + loHi;
+            return {(cross << 32) | (loLo & 0xFFFFFFFFU), (hiLo >> 32) + (cross >> 32) + hiHi};
+#endif
+        }
+
+        inline std::uint64_t multiplyFold(const std::uint64_t a, const std::uint64_t b) noexcept
+        {
+            const Hash128 product = multiply(a, b);
+            return product.low ^ product.high;
+        }
+
+        // XXH64 finalizer
+        constexpr std::uint64_t avalanche64(std::uint64_t h) noexcept
+        {
+            h ^= h >> 33;
+            h *= primes64[1];
+            h ^= h >> 29;
+            h *= primes64[2];
+            h ^= h >> 32;
+            return h;
+        }
+
+        constexpr std::uint64_t avalanche(std::uint64_t h) noexcept
+        {
+            h ^= h >> 37;
+            h *= primeMx1;
+            h ^= h >> 32;
+            return h;
+        }
+
+        constexpr std::uint64_t rrmxmx(std::uint64_t h, const std::uint64_t length) noexcept
+        {
+            h ^= rotateLeft64(h, 49) ^ rotateLeft64(h, 24);
+            h *= primeMx2;
+            h ^= (h >> 35) + length;
+            h *= primeMx2;
+            h ^= h >> 28;
+            return h;
+        }
+
+        inline std::uint64_t mix16(const std::uint8_t* input, const std::uint8_t* secret,
+                                   const std::uint64_t seed) noexcept
+        {
+            return multiplyFold(read64(input) ^ (read64(secret) + seed),
+                                read64(input + 8) ^ (read64(secret + 8) - seed));
+        }
+
+        inline Hash128 mix32(Hash128 acc, const std::uint8_t* input1, const std::uint8_t* input2,
+                             const std::uint8_t* secret, const std::uint64_t seed) noexcept
+        {
+            acc.low += mix16(input1, secret, seed);
+            acc.low ^= read64(input2) + read64(input2 + 8);
+            acc.high += mix16(input2, secret + 16, seed);
+            acc.high ^= read64(input1) + read64(input1 + 8);
+            return acc;
+        }
+
+        inline std::uint64_t hashShort64(const std::uint8_t* input, const std::size_t length,
+                                         const std::uint8_t* secret, std::uint64_t seed) noexcept
+        {
+            if (length == 0)
+                return avalanche64(seed ^ read64(secret + 56) ^ read64(secret + 64));
+            else if (length <= 3)
+            {
+                const std::uint32_t combined = (static_cast<std::uint32_t>(input[0]) << 16) |
+                    (static_cast<std::uint32_t>(input[length >> 1]) << 24) |
+                    static_cast<std::uint32_t>(input[length - 1]) |
+                    (static_cast<std::uint32_t>(length) << 8);
+                const std::uint64_t bitflip = (read32(secret) ^ read32(secret + 4)) + seed;
+                return avalanche64(combined ^ bitflip);
+            }
+            else if (length <= 8)
+            {
+                seed ^= static_cast<std::uint64_t>(swap32(static_cast<std::uint32_t>(seed))) << 32;
+                const std::uint64_t bitflip = (read64(secret + 8) ^ read64(secret + 16)) - seed;
+                const std::uint64_t input64 = read32(input + length - 4) +
+                    (static_cast<std::uint64_t>(read32(input)) << 32);
+                return rrmxmx(input64 ^ bitflip, length);
+            }
+            else if (length <= 16)
+            {
+                const std::uint64_t bitflip1 = (read64(secret + 24) ^ read64(secret + 32)) + seed;
+                const std::uint64_t bitflip2 = (read64(secret + 40) ^ read64(secret + 48)) - seed;
+                const std::uint64_t low = read64(input) ^ bitflip1;
+                const std::uint64_t high = read64(input + length - 8) ^ bitflip2;
+                return avalanche(length + swap64(low) + high + multiplyFold(low, high));
+            }
+            else if (length <= 128)
+            {
+                std::uint64_t acc = length * primes64[0];
+                if (length > 32)
+                {
+                    if (length > 64)
+                    {
+                        if (length > 96)
+                        {
+                            acc += mix16(input + 48, secret + 96, seed);
+                            acc += mix16(input + length - 64, secret + 112, seed);
+                        }
+                        acc += mix16(input + 32, secret + 64, seed);
+                        acc += mix16(input + length - 48, secret + 80, seed);
+                    }
+                    acc += mix16(input + 16, secret + 32, seed);
+                    acc += mix16(input + length - 32, secret + 48, seed);
+                }
+                acc += mix16(input, secret, seed);
+                acc += mix16(input + length - 16, secret + 16, seed);
+                return avalanche(acc);
+            }
+            else
+            {
+                const std::size_t rounds = length / 16;
+                std::uint64_t acc = length * primes64[0];
+                for (std::size_t i = 0; i < 8; ++i)
+                    acc += mix16(input + 16 * i, secret + 16 * i, seed);
+                acc = avalanche(acc);
+                for (std::size_t i = 8; i < rounds; ++i)
+                    acc += mix16(input + 16 * i, secret + 16 * (i - 8) + midSizeStartOffset, seed);
+                acc += mix16(input + length - 16, secret + secretSizeMin - midSizeLastOffset, seed);
+                return avalanche(acc);
+            }
+        }
+
+        inline Hash128 hashShort128(const std::uint8_t* input, const std::size_t length,
+                                    const std::uint8_t* secret, std::uint64_t seed) noexcept
+        {
+            if (length == 0)
+                return {
+                    avalanche64(seed ^ read64(secret + 64) ^ read64(secret + 72)),
+                    avalanche64(seed ^ read64(secret + 80) ^ read64(secret + 88))
+                };
+            else if (length <= 3)
+            {
+                const std::uint32_t combinedLow = (static_cast<std::uint32_t>(input[0]) << 16) |
+                    (static_cast<std::uint32_t>(input[length >> 1]) << 24) |
+                    static_cast<std::uint32_t>(input[length - 1]) |
+                    (static_cast<std::uint32_t>(length) << 8);
+                const std::uint32_t combinedHigh = rotateLeft32(swap32(combinedLow), 13);
+                const std::uint64_t bitflipLow = (read32(secret) ^ read32(secret + 4)) + seed;
+                const std::uint64_t bitflipHigh = (read32(secret + 8) ^ read32(secret + 12)) - seed;
+                return {avalanche64(combinedLow ^ bitflipLow), avalanche64(combinedHigh ^ bitflipHigh)};
+            }
+            else if (length <= 8)
+            {
+                seed ^= static_cast<std::uint64_t>(swap32(static_cast<std::uint32_t>(seed))) << 32;
+                const std::uint64_t input64 = read32(input) +
+                    (static_cast<std::uint64_t>(read32(input + length - 4)) << 32);
+                const std::uint64_t bitflip = (read64(secret + 16) ^ read64(secret + 24)) + seed;
+                Hash128 m = multiply(input64 ^ bitflip, primes64[0] + (length << 2));
+                m.high += m.low << 1;
+                m.low ^= m.high >> 3;
+                m.low ^= m.low >> 35;
+                m.low *= primeMx2;
+                m.low ^= m.low >> 28;
+                m.high = avalanche(m.high);
+                return m;
+            }
+            else if (length <= 16)
+            {
+                const std::uint64_t bitflipLow = (read64(secret + 32) ^ read64(secret + 40)) - seed;
+                const std::uint64_t bitflipHigh = (read64(secret + 48) ^ read64(secret + 56)) + seed;
+                const std::uint64_t low = read64(input);
+                std::uint64_t high = read64(input + length - 8);
+                Hash128 m = multiply(low ^ high ^ bitflipLow, primes64[0]);
+                m.low += static_cast<std::uint64_t>(length - 1) << 54;
+                high ^= bitflipHigh;
+                m.high += high + (high & 0xFFFFFFFFU) * (primes32[1] - 1U);
+                m.low ^= swap64(m.high);
+                Hash128 h = multiply(m.low, primes64[1]);
+                h.high += m.high * primes64[1];
+                return {avalanche(h.low), avalanche(h.high)};
+            }
+            else
+            {
+                Hash128 acc = {length * primes64[0], 0};
+                if (length <= 128)
+                {
+                    if (length > 32)
+                    {
+                        if (length > 64)
+                        {
+                            if (length > 96)
+                                acc = mix32(acc, input + 48, input + length - 64, secret + 96, seed);
+                            acc = mix32(acc, input + 32, input + length - 48, secret + 64, seed);
+                        }
+                        acc = mix32(acc, input + 16, input + length - 32, secret + 32, seed);
+                    }
+                    acc = mix32(acc, input, input + length - 16, secret, seed);
+                }
+                else
+                {
+                    const std::size_t rounds = length / 32;
+                    for (std::size_t i = 0; i < 4; ++i)
+                        acc = mix32(acc, input + 32 * i, input + 32 * i + 16, secret + 32 * i, seed);
+                    acc = {avalanche(acc.low), avalanche(acc.high)};
+                    for (std::size_t i = 4; i < rounds; ++i)
+                        acc = mix32(acc, input + 32 * i, input + 32 * i + 16,
+                                    secret + midSizeStartOffset + 32 * (i - 4), seed);
+                    acc = mix32(acc, input + length - 16, input + length - 32,
+                                secret + secretSizeMin - midSizeLastOffset - 16, 0 - seed);
+                }
+
+                const std::uint64_t low = acc.low + acc.high;
+                const std::uint64_t high = acc.low * primes64[0] + acc.high * primes64[3] +
+                    (length - seed) * primes64[1];
+                return {avalanche(low), 0 - avalanche(high)};
+            }
+        }
+
+        // processes stripes of 64 bytes, the secret advances by 8 bytes per stripe
+        inline void accumulateScalar(Accumulators& accumulators, const std::uint8_t* input,
+                                     const std::uint8_t* secret, const std::size_t stripes) noexcept
+        {
+            for (std::size_t stripe = 0; stripe < stripes; ++stripe)
+                for (std::size_t i = 0; i < accumulatorCount; ++i)
+                {
+                    const std::uint64_t data = read64(input + stripe * stripeLength + i * 8);
+                    const std::uint64_t dataKey = data ^ read64(secret + stripe * secretConsumeRate + i * 8);
+                    accumulators[i ^ 1] += data;
+                    accumulators[i] += (dataKey & 0xFFFFFFFFU) * (dataKey >> 32);
+                }
+        }
+
+        inline void scrambleScalar(Accumulators& accumulators, const std::uint8_t* secret) noexcept
+        {
+            for (std::size_t i = 0; i < accumulatorCount; ++i)
+            {
+                std::uint64_t acc = accumulators[i];
+                acc ^= acc >> 47;
+                acc ^= read64(secret + i * 8);
+                accumulators[i] = acc * primes32[0];
+            }
+        }
+
+#ifdef CPU_X86
+        CPU_TARGET("sse2") inline void accumulateSse2(Accumulators& accumulators, const std::uint8_t* input,
+                                                      const std::uint8_t* secret, const std::size_t stripes) noexcept
+        {
+            __m128i acc[4];
+            for (std::size_t i = 0; i < 4; ++i)
+                acc[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(accumulators.data() + i * 2));
+
+            for (std::size_t stripe = 0; stripe < stripes; ++stripe)
+                for (std::size_t i = 0; i < 4; ++i)
+                {
+                    const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + stripe * stripeLength + i * 16));
+                    const __m128i key = _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret + stripe * secretConsumeRate + i * 16));
+                    const __m128i dataKey = _mm_xor_si128(data, key);
+                    const __m128i product = _mm_mul_epu32(dataKey, _mm_shuffle_epi32(dataKey, _MM_SHUFFLE(0, 3, 0, 1)));
+                    const __m128i swapped = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+                    acc[i] = _mm_add_epi64(acc[i], _mm_add_epi64(product, swapped));
+                }
+
+            for (std::size_t i = 0; i < 4; ++i)
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(accumulators.data() + i * 2), acc[i]);
+        }
+
+        CPU_TARGET("sse2") inline void scrambleSse2(Accumulators& accumulators, const std::uint8_t* secret) noexcept
+        {
+            const __m128i prime = _mm_set1_epi32(static_cast<int>(primes32[0]));
+            for (std::size_t i = 0; i < 4; ++i)
+            {
+                const auto pointer = reinterpret_cast<__m128i*>(accumulators.data() + i * 2);
+                const __m128i acc = _mm_loadu_si128(pointer);
+                const __m128i key = _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret + i * 16));
+                const __m128i dataKey = _mm_xor_si128(_mm_xor_si128(acc, _mm_srli_epi64(acc, 47)), key);
+                const __m128i productLow = _mm_mul_epu32(dataKey, prime);
+                const __m128i productHigh = _mm_mul_epu32(_mm_shuffle_epi32(dataKey, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+                _mm_storeu_si128(pointer, _mm_add_epi64(productLow, _mm_slli_epi64(productHigh, 32)));
+            }
+        }
+
+        CPU_TARGET("avx2") inline void accumulateAvx2(Accumulators& accumulators, const std::uint8_t* input,
+                                                      const std::uint8_t* secret, const std::size_t stripes) noexcept
+        {
+            __m256i acc[2] = {
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(accumulators.data())),
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(accumulators.data() + 4))
+            };
+
+            for (std::size_t stripe = 0; stripe < stripes; ++stripe)
+                for (std::size_t i = 0; i < 2; ++i)
+                {
+                    const __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + stripe * stripeLength + i * 32));
+                    const __m256i key = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(secret + stripe * secretConsumeRate + i * 32));
+                    const __m256i dataKey = _mm256_xor_si256(data, key);
+                    const __m256i product = _mm256_mul_epu32(dataKey, _mm256_shuffle_epi32(dataKey, _MM_SHUFFLE(0, 3, 0, 1)));
+                    const __m256i swapped = _mm256_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+                    acc[i] = _mm256_add_epi64(acc[i], _mm256_add_epi64(product, swapped));
+                }
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(accumulators.data()), acc[0]);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(accumulators.data() + 4), acc[1]);
+        }
+
+        CPU_TARGET("avx2") inline void scrambleAvx2(Accumulators& accumulators, const std::uint8_t* secret) noexcept
+        {
+            const __m256i prime = _mm256_set1_epi32(static_cast<int>(primes32[0]));
+            for (std::size_t i = 0; i < 2; ++i)
+            {
+                const auto pointer = reinterpret_cast<__m256i*>(accumulators.data() + i * 4);
+                const __m256i acc = _mm256_loadu_si256(pointer);
+                const __m256i key = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(secret + i * 32));
+                const __m256i dataKey = _mm256_xor_si256(_mm256_xor_si256(acc, _mm256_srli_epi64(acc, 47)), key);
+                const __m256i productLow = _mm256_mul_epu32(dataKey, prime);
+                const __m256i productHigh = _mm256_mul_epu32(_mm256_shuffle_epi32(dataKey, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+                _mm256_storeu_si256(pointer, _mm256_add_epi64(productLow, _mm256_slli_epi64(productHigh, 32)));
+            }
+        }
+#endif
+
+        inline void accumulate(Accumulators& accumulators, const std::uint8_t* input,
+                               const std::uint8_t* secret, const std::size_t stripes) noexcept
+        {
+#ifdef CPU_X86
+            static const auto function = cpu::select<decltype(&accumulateScalar)>({
+                {cpu::Feature::avx2, accumulateAvx2},
+                {cpu::Feature::sse2, accumulateSse2}
+            }, accumulateScalar);
+            function(accumulators, input, secret, stripes);
+#else
+            accumulateScalar(accumulators, input, secret, stripes);
+#endif
+        }
+
+        inline void scramble(Accumulators& accumulators, const std::uint8_t* secret) noexcept
+        {
+#ifdef CPU_X86
+            static const auto function = cpu::select<decltype(&scrambleScalar)>({
+                {cpu::Feature::avx2, scrambleAvx2},
+                {cpu::Feature::sse2, scrambleSse2}
+            }, scrambleScalar);
+            function(accumulators, secret);
+#else
+            scrambleScalar(accumulators, secret);
+#endif
+        }
+
+        inline std::uint64_t mergeAccumulators(const Accumulators& accumulators, const std::uint8_t* secret,
+                                               std::uint64_t result) noexcept
+        {
+            for (std::size_t i = 0; i < accumulatorCount; i += 2)
+                result += multiplyFold(accumulators[i] ^ read64(secret + i * 8),
+                                       accumulators[i + 1] ^ read64(secret + i * 8 + 8));
+            return avalanche(result);
+        }
+
+        template <typename Result>
+        Result merge(const Accumulators& accumulators, const Secret& secret,
+                     const std::uint64_t length) noexcept
+        {
+            static_assert(std::is_same_v<Result, std::uint64_t> || std::is_same_v<Result, Hash128>,
+                          "XXH3 produces either 64-bit or 128-bit hashes");
+
+            const std::uint64_t low = mergeAccumulators(accumulators, secret.data() + mergeAccumulatorsStart,
+                                                        length * primes64[0]);
+            if constexpr (std::is_same_v<Result, Hash128>)
+                return {low, mergeAccumulators(accumulators, secret.data() + secretSize - stripeLength - mergeAccumulatorsStart,
+                                               ~(length * primes64[1]))};
+            else
+                return low;
+        }
+
+        inline Secret deriveSecret(const std::uint64_t seed) noexcept
+        {
+            Secret result;
+            for (std::size_t i = 0; i < secretSize; i += 16)
+            {
+                write64(result.data() + i, read64(defaultSecret.data() + i) + seed);
+                write64(result.data() + i + 8, read64(defaultSecret.data() + i + 8) - seed);
+            }
+            return result;
+        }
+
+        template <typename Result>
+        Result digest(const std::uint8_t* input, const std::size_t length,
+                      const std::uint64_t seed) noexcept
+        {
+            if (length <= midSizeMax)
+            {
+                if constexpr (std::is_same_v<Result, Hash128>)
+                    return hashShort128(input, length, defaultSecret.data(), seed);
+                else
+                    return hashShort64(input, length, defaultSecret.data(), seed);
+            }
+
+            const Secret secret = seed ? deriveSecret(seed) : defaultSecret;
+            Accumulators accumulators = initialAccumulators;
+
+            const std::size_t blocks = (length - 1) / blockLength;
+            for (std::size_t n = 0; n < blocks; ++n)
+            {
+                accumulate(accumulators, input + n * blockLength, secret.data(), stripesPerBlock);
+                scramble(accumulators, secret.data() + secretSize - stripeLength);
+            }
+
+            const std::size_t stripes = (length - 1 - blocks * blockLength) / stripeLength;
+            accumulate(accumulators, input + blocks * blockLength, secret.data(), stripes);
+
+            // the last stripe may overlap the previous one
+            accumulate(accumulators, input + length - stripeLength,
+                       secret.data() + secretSize - stripeLength - lastAccumulateStart, 1);
+
+            return merge<Result>(accumulators, secret, length);
+        }
+    }
+
+    class Hasher final
+    {
+    public:
+        explicit Hasher(const std::uint64_t s = 0) noexcept:
+            seed(s), secret(s ? deriveSecret(s) : defaultSecret)
+        {
+        }
+
+        template <class Iterator>
+        void update(Iterator i, const Iterator end) noexcept
+        {
+            if constexpr (std::is_pointer_v<Iterator> &&
+                          sizeof(typename std::iterator_traits<Iterator>::value_type) == 1)
+                process(reinterpret_cast<const std::uint8_t*>(i), static_cast<std::size_t>(end - i));
+            else
+            {
+                std::array<std::uint8_t, bufferSize> chunk;
+                std::size_t size = 0;
+                for (; i != end; ++i)
+                {
+                    chunk[size++] = static_cast<std::uint8_t>(*i);
+                    if (size == chunk.size())
+                    {
+                        process(chunk.data(), size);
+                        size = 0;
+                    }
+                }
+                process(chunk.data(), size);
+            }
+        }
+
+        template <class T>
+        void update(const T& v) noexcept
+        {
+            update(std::begin(v), std::end(v));
+        }
+
+        template <typename Result>
+        Result finalize() const noexcept
+        {
+            if (totalLength <= midSizeMax)
+                return digest<Result>(buffer.data(), static_cast<std::size_t>(totalLength), seed);
+
+            Accumulators acc = accumulators;
+            std::size_t stripes = stripesSoFar;
+
+            if (bufferedSize >= stripeLength)
+            {
+                consumeStripes(acc, stripes, buffer.data(), (bufferedSize - 1) / stripeLength);
+                accumulate(acc, buffer.data() + bufferedSize - stripeLength,
+                           secret.data() + secretSize - stripeLength - lastAccumulateStart, 1);
+            }
+            else
+            {
+                // the last stripe continues from the tail of the previously consumed data
+                std::array<std::uint8_t, stripeLength> lastStripe;
+                const std::size_t catchUp = stripeLength - bufferedSize;
+                std::copy(buffer.end() - static_cast<std::ptrdiff_t>(catchUp), buffer.end(), lastStripe.begin());
+                std::copy(buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(bufferedSize),
+                          lastStripe.begin() + static_cast<std::ptrdiff_t>(catchUp));
+                accumulate(acc, lastStripe.data(),
+                           secret.data() + secretSize - stripeLength - lastAccumulateStart, 1);
+            }
+
+            return merge<Result>(acc, secret, totalLength);
+        }
+
+    private:
+        void consumeStripes(Accumulators& acc, std::size_t& stripes,
+                            const std::uint8_t* input, const std::size_t count) const noexcept
+        {
+            if (stripesPerBlock - stripes <= count)
+            {
+                const std::size_t toEnd = stripesPerBlock - stripes;
+                accumulate(acc, input, secret.data() + stripes * secretConsumeRate, toEnd);
+                scramble(acc, secret.data() + secretSize - stripeLength);
+                accumulate(acc, input + toEnd * stripeLength, secret.data(), count - toEnd);
+                stripes = count - toEnd;
+            }
+            else
+            {
+                accumulate(acc, input, secret.data() + stripes * secretConsumeRate, count);
+                stripes += count;
+            }
+        }
+
+        void process(const std::uint8_t* input, const std::size_t length) noexcept
+        {
+            totalLength += length;
+
+            // at least one byte is always kept buffered for the last stripe
+            if (bufferedSize + length <= bufferSize)
+            {
+                std::copy(input, input + length, buffer.begin() + static_cast<std::ptrdiff_t>(bufferedSize));
+                bufferedSize += length;
+                return;
+            }
+
+            const std::uint8_t* end = input + length;
+
+            if (bufferedSize)
+            {
+                const std::size_t loadSize = bufferSize - bufferedSize;
+                std::copy(input, input + loadSize, buffer.begin() + static_cast<std::ptrdiff_t>(bufferedSize));
+                input += loadSize;
+                consumeStripes(accumulators, stripesSoFar, buffer.data(), bufferSize / stripeLength);
+                bufferedSize = 0;
+            }
+
+            if (static_cast<std::size_t>(end - input) > bufferSize)
+            {
+                do
+                {
+                    consumeStripes(accumulators, stripesSoFar, input, bufferSize / stripeLength);
+                    input += bufferSize;
+                }
+                while (static_cast<std::size_t>(end - input) > bufferSize);
+
+                std::copy(input - stripeLength, input, buffer.end() - stripeLength);
+            }
+
+            std::copy(input, end, buffer.begin());
+            bufferedSize = static_cast<std::size_t>(end - input);
+        }
+
+        std::uint64_t seed = 0;
+        Secret secret;
+        Accumulators accumulators = initialAccumulators;
+        std::array<std::uint8_t, bufferSize> buffer{};
+        std::size_t bufferedSize = 0;
+        std::size_t stripesSoFar = 0;
+        std::uint64_t totalLength = 0;
+    };
+
+    template <typename Result, class Iterator>
+    Result hash(const Iterator begin, const Iterator end,
+                const std::uint64_t seed = 0) noexcept
+    {
+        if constexpr (std::is_pointer_v<Iterator> &&
+                      sizeof(typename std::iterator_traits<Iterator>::value_type) == 1)
+            return digest<Result>(reinterpret_cast<const std::uint8_t*>(begin),
+                                  static_cast<std::size_t>(end - begin), seed);
+        else
+        {
+            Hasher hasher(seed);
+            hasher.update(begin, end);
+            return hasher.finalize<Result>();
+        }
+    }
+
+    template <typename Result, class T>
+    Result hash(const T& v, const std::uint64_t seed = 0) noexcept
+    {
+        if constexpr (IsContiguous<T>::value && sizeof(*std::begin(v)) == 1)
+            return hash<Result>(std::data(v), std::data(v) + std::size(v), seed);
+        else
+            return hash<Result>(std::begin(v), std::end(v), seed);
+    }
+}
+
+#endif // XXH3_HPP
@@ -0,0 +1,996 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <numeric>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#  include <x86intrin.h>
+#  define BENCHMARK_CYCLES
+#elif defined(_M_X64) || defined(_M_IX86)
+#  include <intrin.h>
+#  define BENCHMARK_CYCLES
+#endif
+#include "aes.hpp"
+#include "base64.hpp"
+#include "cpu.hpp"
+#include "crc.hpp"
+#include "fnv1.hpp"
+#include "hex.hpp"
+#include "md5.hpp"
+#include "sha1.hpp"
+#include "sha2.hpp"
+#include "utf8.hpp"
+#include "uuid.hpp"
+#include "xxh3.hpp"
+
+namespace
+{
+    struct Options final
+    {
+        std::regex filter{""};
+        double minTime = 0.1; // seconds per measurement
+        std::size_t repetitions = 1;
+        std::size_t maxSize = 64 * 1024 * 1024;
+        bool json = false;
+        std::string output;
+        std::string baseline;
+        double threshold = 0.05; // smallest relative slowdown reported as a regression
+        double alpha = 0.05; // significance level of the comparison
+    };
+
+    struct Measurement final
+    {
+        std::string name;
+        std::size_t repetition;
+        std::uint64_t iterations;
+        double realTime; // nanoseconds per iteration
+        double cpuTime; // nanoseconds per iteration
+        double cycles; // time stamp counter ticks per iteration, 0 without a counter
+        std::size_t bytes; // bytes processed per iteration, 0 for single operations
+    };
+
+    // keeps the compiler from discarding results that are never read
+    template <class T>
+    inline void doNotOptimize(const T& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r"(&value) : "memory");
+#else
+        static const void* volatile sink;
+        sink = &value;
+#endif
+    }
+
+    // reference cycles of the time stamp counter, which ticks at a constant rate on current CPUs,
+    // so they match core cycles only when the core runs at its nominal frequency
+    inline std::uint64_t readCycles() noexcept
+    {
+#ifdef BENCHMARK_CYCLES
+        return __rdtsc();
+#else
+        return 0;
+#endif
+    }
+
+    class Runner final
+    {
+    public:
+        explicit Runner(const Options& o): options{o}
+        {
+            for (std::size_t size = 16; size <= options.maxSize; size *= 4)
+                sizes.push_back(size);
+        }
+
+        bool isEnabled(const std::string& name) const
+        {
+            return std::regex_search(name, options.filter);
+        }
+
+        const std::vector<std::size_t>& getSizes() const noexcept { return sizes; }
+        const std::vector<Measurement>& getMeasurements() const noexcept { return measurements; }
+
+        // calls the function until the measurement takes at least the minimum time, the first repetition
+        // finds the iteration count and the others reuse it,
+        // bytes is the amount of data the function processes per call, 0 for a single operation
+        template <class Function>
+        void run(const std::string& name, const std::size_t bytes, Function function)
+        {
+            if (!isEnabled(name)) return;
+
+            // warms up the caches and lets the headers detect the instruction set
+            function();
+
+            std::uint64_t iterations = 1;
+            for (std::size_t repetition = 0; repetition < options.repetitions;)
+            {
+                const auto cpuStart = std::clock();
+                const auto cyclesStart = readCycles();
+                const auto start = std::chrono::steady_clock::now();
+
+                for (std::uint64_t i = 0; i < iterations; ++i)
+                    function();
+
+                const auto end = std::chrono::steady_clock::now();
+                const auto cycles = readCycles() - cyclesStart;
+                const auto cpu = std::clock() - cpuStart;
+
+                const double elapsed = std::chrono::duration<double>(end - start).count();
+                if (repetition || elapsed >= options.minTime || iterations >= maxIterations)
+                {
+                    const auto count = static_cast<double>(iterations);
+                    add({name, repetition++, iterations,
+                        elapsed * 1e9 / count,
+                        static_cast<double>(cpu) * 1e9 / CLOCKS_PER_SEC / count,
+                        static_cast<double>(cycles) / count,
+                        bytes});
+                    continue;
+                }
+
+                // aim 40% past the minimum time, but grow at most tenfold per round
+                const double factor = elapsed > 0.0 ? std::min(options.minTime * 1.4 / elapsed, 10.0) : 10.0;
+                iterations = std::max(iterations + 1, static_cast<std::uint64_t>(static_cast<double>(iterations) * factor));
+            }
+        }
+
+    private:
+        static constexpr std::uint64_t maxIterations = 1000000000;
+
+        void add(const Measurement& measurement)
+        {
+            measurements.push_back(measurement);
+            if (options.json && options.output.empty()) return;
+
+            char line[160];
+            if (measurement.bytes)
+                std::snprintf(line, sizeof(line), "%-36s %12llu %12.1f ns %10.1f MB/s %8.2f cycles/B\n",
+                              measurement.name.c_str(),
+                              static_cast<unsigned long long>(measurement.iterations),
+                              measurement.realTime,
+                              static_cast<double>(measurement.bytes) * 1e3 / measurement.realTime,
+                              measurement.cycles / static_cast<double>(measurement.bytes));
+            else
+                std::snprintf(line, sizeof(line), "%-36s %12llu %12.1f ns %10.1f M/s  %8.1f cycles\n",
+                              measurement.name.c_str(),
+                              static_cast<unsigned long long>(measurement.iterations),
+                              measurement.realTime,
+                              1e3 / measurement.realTime,
+                              measurement.cycles);
+            std::cout << line << std::flush;
+        }
+
+        Options options;
+        std::vector<std::size_t> sizes;
+        std::vector<Measurement> measurements;
+    };
+
+    std::string sizedName(const std::string& name, const std::size_t size)
+    {
+        return name + '/' + std::to_string(size);
+    }
+
+    std::vector<std::uint8_t> randomBytes(const std::size_t size)
+    {
+        std::vector<std::uint8_t> result(size);
+        uuid::Xoshiro256 engine{42};
+        for (std::size_t i = 0; i < size; i += 8)
+        {
+            const std::uint64_t value = engine();
+            std::memcpy(result.data() + i, &value, std::min<std::size_t>(8, size - i));
+        }
+        return result;
+    }
+
+    // text made of 16-byte pieces, so that every benchmarked size ends on a code point boundary
+    std::string randomText(const std::size_t size, const bool ascii)
+    {
+        static const char* const pieces[] = {
+            "The quick brown ",
+            "Gr\u00FC\u00DFe, K\u00F6ln! ",
+            "\u041C\u0438\u0440, \u043C\u0438\u0440! ",
+            "\u3053\u3093\u306B\u3061\u306F.",
+            "\U0001F600\U0001F601\U0001F602\U0001F923"
+        };
+
+        std::string result;
+        result.reserve(size);
+        uuid::Xoshiro256 engine{42};
+        while (result.size() < size)
+            result += pieces[ascii ? 0 : engine() % std::size(pieces)];
+        return result;
+    }
+
+    void benchmarkAes(Runner& runner, const std::vector<std::uint8_t>& data)
+    {
+        const auto key = randomBytes(32);
+        const auto initVector = randomBytes(16);
+
+        const auto benchmark = [&](const std::string& name, auto encrypt, auto decrypt) {
+            for (const auto size : runner.getSizes())
+            {
+                const auto begin = data.begin();
+                const auto end = data.begin() + static_cast<std::ptrdiff_t>(size);
+                runner.run(sizedName(name + "/encrypt", size), size, [&] {
+                    doNotOptimize(encrypt(begin, end));
+                });
+
+                if (!runner.isEnabled(sizedName(name + "/decrypt", size))) continue;
+                const auto encrypted = encrypt(begin, end);
+                runner.run(sizedName(name + "/decrypt", size), size, [&] {
+                    doNotOptimize(decrypt(encrypted.begin(), encrypted.end()));
+                });
+            }
+        };
+
+        using Iterator = std::vector<std::uint8_t>::const_iterator;
+        benchmark("aes128/ecb",
+                  [&](Iterator b, Iterator e) { return aes::encryptEcb<128>(b, e, key); },
+                  [&](Iterator b, Iterator e) { return aes::decryptEcb<128>(b, e, key); });
+        benchmark("aes256/ecb",
+                  [&](Iterator b, Iterator e) { return aes::encryptEcb<256>(b, e, key); },
+                  [&](Iterator b, Iterator e) { return aes::decryptEcb<256>(b, e, key); });
+        benchmark("aes256/cbc",
+                  [&](Iterator b, Iterator e) { return aes::encryptCbc<256>(b, e, key, initVector); },
+                  [&](Iterator b, Iterator e) { return aes::decryptCbc<256>(b, e, key, initVector); });
+        benchmark("aes256/cfb",
+                  [&](Iterator b, Iterator e) { return aes::encryptCfb<256>(b, e, key, initVector); },
+                  [&](Iterator b, Iterator e) { return aes::decryptCfb<256>(b, e, key, initVector); });
+    }
+
+    void benchmarkBase64(Runner& runner, const std::vector<std::uint8_t>& data)
+    {
+        std::vector<char> text;
+        std::vector<std::uint8_t> decoded;
+
+        for (const auto size : runner.getSizes())
+        {
+            text.resize(base64::encodedSize(size));
+            runner.run(sizedName("base64/encode", size), size, [&] {
+                doNotOptimize(base64::encode(data.data(), size, text.data()));
+            });
+            runner.run(sizedName("base64url/encode", size), size, [&] {
+                doNotOptimize(base64url::encode(data.data(), size, text.data(), false));
+            });
+
+            base64::encode(data.data(), size, text.data());
+            decoded.resize(size);
+            runner.run(sizedName("base64/decode", size), size, [&] {
+                doNotOptimize(base64::decode(text.data(), text.size(), decoded.data(), decoded.size()));
+            });
+        }
+    }
+
+    void benchmarkCrc(Runner& runner, const std::vector<std::uint8_t>& data)
+    {
+        const auto benchmark = [&](const std::string& name, auto generate) {
+            for (const auto size : runner.getSizes())
+                runner.run(sizedName(name, size), size, [&] {
+                    doNotOptimize(generate(data.data(), data.data() + size));
+                });
+        };
+
+        benchmark("crc8", [](const std::uint8_t* b, const std::uint8_t* e) { return crc::Crc8::generate(b, e); });
+        benchmark("crc16ccitt", [](const std::uint8_t* b, const std::uint8_t* e) { return crc::Crc16Ccitt::generate(b, e); });
+        benchmark("crc32", [](const std::uint8_t* b, const std::uint8_t* e) { return crc::Crc32::generate(b, e); });
+        benchmark("crc32c", [](const std::uint8_t* b, const std::uint8_t* e) { return crc::Crc32c::generate(b, e); });
+        benchmark("crc64ecma", [](const std::uint8_t* b, const std::uint8_t* e) { return crc::Crc64Ecma::generate(b, e); });
+        benchmark("crc64xz", [](const std::uint8_t* b, const std::uint8_t* e) { return crc::Crc64Xz::generate(b, e); });
+    }
+
+    void benchmarkHashes(Runner& runner, const std::vector<std::uint8_t>& data)
+    {
+        const auto benchmark = [&](const std::string& name, auto hash) {
+            for (const auto size : runner.getSizes())
+                runner.run(sizedName(name, size), size, [&] {
+                    doNotOptimize(hash(data.data(), data.data() + size));
+                });
+        };
+
+        benchmark("fnv1/32", [](const std::uint8_t* b, const std::uint8_t* e) { return fnv1::hash<std::uint32_t>(b, e); });
+        benchmark("fnv1/64", [](const std::uint8_t* b, const std::uint8_t* e) { return fnv1::hash<std::uint64_t>(b, e); });
+        benchmark("fnv1a/32", [](const std::uint8_t* b, const std::uint8_t* e) { return fnv1a::hash<std::uint32_t>(b, e); });
+        benchmark("fnv1a/64", [](const std::uint8_t* b, const std::uint8_t* e) { return fnv1a::hash<std::uint64_t>(b, e); });
+        benchmark("md5", [](const std::uint8_t* b, const std::uint8_t* e) { return md5::hash(b, e); });
+        benchmark("sha1", [](const std::uint8_t* b, const std::uint8_t* e) { return sha1::hash(b, e); });
+        benchmark("sha256", [](const std::uint8_t* b, const std::uint8_t* e) { return sha256::hash(b, e); });
+        benchmark("xxh3/64", [](const std::uint8_t* b, const std::uint8_t* e) { return xxh3::hash<std::uint64_t>(b, e); });
+        benchmark("xxh3/128", [](const std::uint8_t* b, const std::uint8_t* e) { return xxh3::hash<xxh3::Hash128>(b, e); });
+    }
+
+    void benchmarkHex(Runner& runner, const std::vector<std::uint8_t>& data)
+    {
+        std::vector<char> text;
+        std::vector<std::uint8_t> decoded;
+
+        for (const auto size : runner.getSizes())
+        {
+            text.resize(hex::encodedSize(size));
+            runner.run(sizedName("hex/encode", size), size, [&] {
+                doNotOptimize(hex::encode(data.data(), size, text.data()));
+            });
+
+            hex::encode(data.data(), size, text.data());
+            decoded.resize(size);
+            runner.run(sizedName("hex/decode", size), size, [&] {
+                doNotOptimize(hex::decode(text.data(), text.size(), decoded.data(), decoded.size()));
+            });
+        }
+    }
+
+    void benchmarkUtf8(Runner& runner)
+    {
+        for (const bool ascii : {true, false})
+        {
+            const std::string prefix = ascii ? "utf8/ascii/" : "utf8/mixed/";
+            const auto text = randomText(runner.getSizes().empty() ? 0 : runner.getSizes().back(), ascii);
+            std::u16string utf16;
+            std::u32string utf32;
+            std::vector<char> output;
+
+            for (const auto size : runner.getSizes())
+            {
+                runner.run(sizedName(prefix + "validate", size), size, [&] {
+                    doNotOptimize(utf8::validate(text.data(), size));
+                });
+                runner.run(sizedName(prefix + "countCodePoints", size), size, [&] {
+                    doNotOptimize(utf8::countCodePoints(text.data(), size));
+                });
+                runner.run(sizedName(prefix + "toUtf32", size), size, [&] {
+                    doNotOptimize(utf8::toUtf32(text.data(), text.data() + size));
+                });
+
+                utf16.resize(size);
+                runner.run(sizedName(prefix + "toUtf16", size), size, [&] {
+                    doNotOptimize(utf8::toUtf16(text.data(), size, utf16.data(), utf16.size()));
+                });
+
+                // the conversions back to UTF-8 are measured by the UTF-8 bytes they produce
+                utf16.resize(utf8::toUtf16(text.data(), size, utf16.data(), utf16.size()).size);
+                output.resize(size);
+                runner.run(sizedName(prefix + "fromUtf16", size), size, [&] {
+                    doNotOptimize(utf8::fromUtf16(utf16.data(), utf16.size(), output.data(), output.size()));
+                });
+
+                utf32 = utf8::toUtf32(text.data(), text.data() + size);
+                runner.run(sizedName(prefix + "fromUtf32", size), size, [&] {
+                    doNotOptimize(utf8::fromUtf32(utf32.data(), utf32.size(), output.data(), output.size()));
+                });
+
+                const std::string_view view{text.data(), size};
+                runner.run(sizedName(prefix + "isNormalized", size), size, [&] {
+                    doNotOptimize(utf8::isNormalized(view));
+                });
+                runner.run(sizedName(prefix + "normalize/nfd", size), size, [&] {
+                    doNotOptimize(utf8::normalize(view, utf8::NormalizationForm::nfd));
+                });
+                runner.run(sizedName(prefix + "foldCase", size), size, [&] {
+                    doNotOptimize(utf8::foldCase(view));
+                });
+            }
+        }
+    }
+
+    void benchmarkUuid(Runner& runner)
+    {
+        uuid::Xoshiro256 engine{42};
+        runner.run("uuid/generate", 0, [&] { doNotOptimize(uuid::generate(engine)); });
+        runner.run("uuid/generate/thread", 0, [] { doNotOptimize(uuid::generate()); });
+        runner.run("uuid/generateV7", 0, [&] { doNotOptimize(uuid::generateV7(engine)); });
+        runner.run("uuid/generateV6", 0, [&] { doNotOptimize(uuid::generateV6(engine)); });
+
+        const uuid::NameGeneratorV5 generator{uuid::dnsNamespace};
+        runner.run("uuid/generateV5", 0, [&] { doNotOptimize(generator.generate("www.example.com")); });
+
+        std::vector<std::array<std::uint8_t, 16>> uuids(1024);
+        runner.run(sizedName("uuid/generateN", uuids.size()), uuids.size() * 16, [&] {
+            uuid::generateN(uuids.data(), uuids.size(), engine);
+            doNotOptimize(uuids);
+        });
+
+        const std::string text = "2ed6657d-e927-568b-95e1-2665a8aea6a2";
+        runner.run("uuid/parse", 0, [&] {
+            uuid::Value value;
+            doNotOptimize(uuid::parse(text.data(), text.size(), value));
+            doNotOptimize(value);
+        });
+
+        const auto value = uuid::parse<uuid::Value>(text);
+        char buffer[uuid::stringLength];
+        runner.run("uuid/toChars", 0, [&] {
+            doNotOptimize(uuid::toChars(value, buffer));
+        });
+        auto key = value;
+        runner.run("uuid/hash", 0, [&] {
+            ++key.low;
+            doNotOptimize(std::hash<uuid::Value>{}(key));
+        });
+    }
+
+    std::string escape(const std::string& s)
+    {
+        std::string result;
+        for (const char c : s)
+        {
+            if (c == '"' || c == '\\') result += '\\';
+            result += c;
+        }
+        return result;
+    }
+
+    double median(std::vector<double> values)
+    {
+        std::sort(values.begin(), values.end());
+        const auto middle = values.size() / 2;
+        return values.size() % 2 ? values[middle] : (values[middle - 1] + values[middle]) / 2.0;
+    }
+
+    void writeEntry(std::ostream& stream, const std::string& name, const std::string& runName,
+                    const std::string& aggregate, const std::size_t repetitions, const std::size_t repetition,
+                    const Measurement& measurement)
+    {
+        stream << "    {\n";
+        stream << "      \"name\": \"" << escape(name) << "\",\n";
+        stream << "      \"run_name\": \"" << escape(runName) << "\",\n";
+        if (aggregate.empty())
+            stream << "      \"run_type\": \"iteration\",\n";
+        else
+        {
+            stream << "      \"run_type\": \"aggregate\",\n";
+            stream << "      \"aggregate_name\": \"" << aggregate << "\",\n";
+        }
+        stream << "      \"repetitions\": " << repetitions << ",\n";
+        if (aggregate.empty())
+            stream << "      \"repetition_index\": " << repetition << ",\n";
+        stream << "      \"iterations\": " << measurement.iterations << ",\n";
+        stream << "      \"real_time\": " << measurement.realTime << ",\n";
+        stream << "      \"cpu_time\": " << measurement.cpuTime << ",\n";
+        stream << "      \"time_unit\": \"ns\",\n";
+        if (measurement.bytes)
+        {
+            stream << "      \"bytes\": " << measurement.bytes << ",\n";
+            stream << "      \"bytes_per_second\": " << static_cast<double>(measurement.bytes) * 1e9 / measurement.realTime << ",\n";
+            stream << "      \"cycles_per_byte\": " << measurement.cycles / static_cast<double>(measurement.bytes) << "\n";
+        }
+        else
+        {
+            stream << "      \"items_per_second\": " << 1e9 / measurement.realTime << ",\n";
+            stream << "      \"cycles\": " << measurement.cycles << "\n";
+        }
+        stream << "    }";
+    }
+
+    // the layout of Google Benchmark's JSON reporter, so that its tooling can read the results,
+    // repeated benchmarks are followed by their mean, median and standard deviation
+    void writeJson(std::ostream& stream, const std::vector<Measurement>& measurements)
+    {
+        char date[32] = {};
+        const std::time_t now = std::time(nullptr);
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", std::localtime(&now));
+
+        stream.precision(10);
+        stream << "{\n";
+        stream << "  \"context\": {\n";
+        stream << "    \"date\": \"" << date << "\",\n";
+        stream << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n";
+        // the instruction set tier the kernels were picked for, lowered by HLIBS_CPU
+        stream << "    \"cpu_tier\": \"" << cpu::getName(cpu::getTier()) << "\",\n";
+#ifdef DEBUG
+        stream << "    \"library_build_type\": \"debug\"\n";
+#else
+        stream << "    \"library_build_type\": \"release\"\n";
+#endif
+        stream << "  },\n";
+        stream << "  \"benchmarks\": [";
+
+        bool first = true;
+        for (std::size_t begin = 0, end = 0; begin != measurements.size(); begin = end)
+        {
+            const auto& name = measurements[begin].name;
+            while (end != measurements.size() && measurements[end].name == name) ++end;
+            const auto repetitions = end - begin;
+
+            for (std::size_t i = begin; i != end; ++i)
+            {
+                stream << (first ? "\n" : ",\n");
+                first = false;
+                writeEntry(stream, name, name, {}, repetitions, measurements[i].repetition, measurements[i]);
+            }
+
+            if (repetitions < 2) continue;
+
+            const auto count = static_cast<double>(repetitions);
+            std::vector<double> realTimes;
+            std::vector<double> cpuTimes;
+            std::vector<double> cycles;
+            for (std::size_t i = begin; i != end; ++i)
+            {
+                realTimes.push_back(measurements[i].realTime);
+                cpuTimes.push_back(measurements[i].cpuTime);
+                cycles.push_back(measurements[i].cycles);
+            }
+
+            Measurement mean = measurements[begin];
+            mean.realTime = std::accumulate(realTimes.begin(), realTimes.end(), 0.0) / count;
+            mean.cpuTime = std::accumulate(cpuTimes.begin(), cpuTimes.end(), 0.0) / count;
+            mean.cycles = std::accumulate(cycles.begin(), cycles.end(), 0.0) / count;
+
+            Measurement middle = measurements[begin];
+            middle.realTime = median(realTimes);
+            middle.cpuTime = median(cpuTimes);
+            middle.cycles = median(cycles);
+
+            Measurement deviation = measurements[begin];
+            deviation.realTime = 0.0;
+            deviation.cpuTime = 0.0;
+            deviation.cycles = 0.0;
+            for (std::size_t i = 0; i != repetitions; ++i)
+            {
+                deviation.realTime += (realTimes[i] - mean.realTime) * (realTimes[i] - mean.realTime);
+                deviation.cpuTime += (cpuTimes[i] - mean.cpuTime) * (cpuTimes[i] - mean.cpuTime);
+                deviation.cycles += (cycles[i] - mean.cycles) * (cycles[i] - mean.cycles);
+            }
+            deviation.realTime = std::sqrt(deviation.realTime / (count - 1.0));
+            deviation.cpuTime = std::sqrt(deviation.cpuTime / (count - 1.0));
+            deviation.cycles = std::sqrt(deviation.cycles / (count - 1.0));
+
+            for (const auto& [aggregate, measurement] : {std::pair<const char*, const Measurement&>{"mean", mean},
+                                                          std::pair<const char*, const Measurement&>{"median", middle},
+                                                          std::pair<const char*, const Measurement&>{"stddev", deviation}})
+            {
+                stream << ",\n";
+                writeEntry(stream, name + '_' + aggregate, name, aggregate, repetitions, 0, measurement);
+            }
+        }
+
+        stream << "\n  ]\n}\n";
+    }
+
+    // just enough JSON to read result files back: objects, arrays, strings, numbers and literals
+    struct Json final
+    {
+        enum class Type
+        {
+            null,
+            boolean,
+            number,
+            string,
+            array,
+            object
+        };
+
+        const Json* find(const std::string& key) const noexcept
+        {
+            for (const auto& member : members)
+                if (member.first == key) return &member.second;
+            return nullptr;
+        }
+
+        Type type = Type::null;
+        bool boolean = false;
+        double number = 0.0;
+        std::string string;
+        std::vector<Json> elements;
+        std::vector<std::pair<std::string, Json>> members;
+    };
+
+    class JsonParser final
+    {
+    public:
+        explicit JsonParser(const std::string& t) noexcept: text{t} {}
+
+        Json parse()
+        {
+            Json result = parseValue();
+            skipWhitespace();
+            if (position != text.size()) fail("Unexpected data");
+            return result;
+        }
+
+    private:
+        [[noreturn]] void fail(const std::string& message) const
+        {
+            throw std::runtime_error(message + " at offset " + std::to_string(position));
+        }
+
+        void skipWhitespace() noexcept
+        {
+            while (position != text.size() &&
+                   (text[position] == ' ' || text[position] == '\t' || text[position] == '\n' || text[position] == '\r'))
+                ++position;
+        }
+
+        bool consume(const char c) noexcept
+        {
+            skipWhitespace();
+            if (position == text.size() || text[position] != c) return false;
+            ++position;
+            return true;
+        }
+
+        void expect(const char c)
+        {
+            if (!consume(c)) fail(std::string{"Expected '"} + c + '\'');
+        }
+
+        std::uint32_t parseHex()
+        {
+            if (text.size() - position < 4) fail("Invalid escape sequence");
+            std::uint8_t bytes[2];
+            if (hex::decode(text.data() + position, 4, bytes, sizeof(bytes)).error != hex::Error::none)
+                fail("Invalid escape sequence");
+            position += 4;
+            return (static_cast<std::uint32_t>(bytes[0]) << 8) | bytes[1];
+        }
+
+        std::string parseString()
+        {
+            expect('"');
+
+            std::string result;
+            for (;;)
+            {
+                if (position == text.size()) fail("Unterminated string");
+                const char c = text[position++];
+                if (c == '"') return result;
+                if (c != '\\')
+                {
+                    result += c;
+                    continue;
+                }
+
+                if (position == text.size()) fail("Unterminated string");
+                switch (const char escaped = text[position++])
+                {
+                    case 'b': result += '\b'; break;
+                    case 'f': result += '\f'; break;
+                    case 'n': result += '\n'; break;
+                    case 'r': result += '\r'; break;
+                    case 't': result += '\t'; break;
+                    case 'u':
+                    {
+                        std::uint32_t cp = parseHex();
+                        if (cp >= 0xD800 && cp <= 0xDBFF && text.compare(position, 2, "\\u") == 0)
+                        {
+                            position += 2;
+                            cp = 0x10000 + ((cp - 0xD800) << 10) + (parseHex() - 0xDC00);
+                        }
+
+                        char encoded[4];
+                        const auto length = utf8::fromUtf32(static_cast<char32_t>(cp), encoded);
+                        if (!length) fail("Invalid code point");
+                        result.append(encoded, length);
+                        break;
+                    }
+                    default: result += escaped;
+                }
+            }
+        }
+
+        Json parseValue()
+        {
+            skipWhitespace();
+            if (position == text.size()) fail("Unexpected end");
+
+            Json value;
+            if (consume('{'))
+            {
+                value.type = Json::Type::object;
+                if (consume('}')) return value;
+                do
+                {
+                    skipWhitespace();
+                    auto key = parseString();
+                    expect(':');
+                    value.members.emplace_back(std::move(key), parseValue());
+                }
+                while (consume(','));
+                expect('}');
+            }
+            else if (consume('['))
+            {
+                value.type = Json::Type::array;
+                if (consume(']')) return value;
+                do value.elements.push_back(parseValue());
+                while (consume(','));
+                expect(']');
+            }
+            else if (text[position] == '"')
+            {
+                value.type = Json::Type::string;
+                value.string = parseString();
+            }
+            else if (text.compare(position, 4, "true") == 0 || text.compare(position, 5, "false") == 0)
+            {
+                value.type = Json::Type::boolean;
+                value.boolean = text[position] == 't';
+                position += value.boolean ? 4 : 5;
+            }
+            else if (text.compare(position, 4, "null") == 0)
+                position += 4;
+            else
+            {
+                const char* begin = text.c_str() + position;
+                char* end;
+                value.type = Json::Type::number;
+                value.number = std::strtod(begin, &end);
+                if (end == begin) fail("Invalid value");
+                position += static_cast<std::size_t>(end - begin);
+            }
+
+            return value;
+        }
+
+        const std::string& text;
+        std::size_t position = 0;
+    };
+
+    // real times in nanoseconds of every repetition by benchmark name
+    using Samples = std::map<std::string, std::vector<double>>;
+
+    Samples loadSamples(const std::string& path)
+    {
+        std::ifstream file{path, std::ios::binary};
+        if (!file) throw std::runtime_error("Failed to open " + path);
+        const std::string text{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+
+        const auto root = JsonParser{text}.parse();
+        const auto benchmarks = root.find("benchmarks");
+        if (!benchmarks || benchmarks->type != Json::Type::array)
+            throw std::runtime_error(path + " has no benchmarks");
+
+        Samples result;
+        for (const auto& benchmark : benchmarks->elements)
+        {
+            const auto runType = benchmark.find("run_type");
+            if (runType && runType->string != "iteration") continue;
+
+            const auto name = benchmark.find("run_name") ? benchmark.find("run_name") : benchmark.find("name");
+            const auto realTime = benchmark.find("real_time");
+            if (!name || !realTime || realTime->type != Json::Type::number) continue;
+
+            const auto timeUnit = benchmark.find("time_unit");
+            const std::string unit = timeUnit ? timeUnit->string : "ns";
+            const double scale = unit == "s" ? 1e9 : unit == "ms" ? 1e6 : unit == "us" ? 1e3 : 1.0;
+            result[name->string].push_back(realTime->number * scale);
+        }
+        return result;
+    }
+
+    // the one-sided Mann-Whitney U test: the probability of the current samples being at least this much
+    // slower than the baseline ones if both came from the same distribution,
+    // exact for small samples without ties, otherwise the normal approximation with a tie correction
+    double slowdownProbability(const std::vector<double>& baseline, const std::vector<double>& current)
+    {
+        const std::size_t n = current.size();
+        const std::size_t m = baseline.size();
+
+        double u = 0.0;
+        for (const double c : current)
+            for (const double b : baseline)
+                u += c > b ? 1.0 : c == b ? 0.5 : 0.0;
+
+        std::vector<double> all = current;
+        all.insert(all.end(), baseline.begin(), baseline.end());
+        std::sort(all.begin(), all.end());
+
+        double ties = 0.0;
+        for (std::size_t begin = 0, end = 0; begin != all.size(); begin = end)
+        {
+            while (end != all.size() && all[end] == all[begin]) ++end;
+            const auto t = static_cast<double>(end - begin);
+            ties += t * t * t - t;
+        }
+
+        if (ties == 0.0 && n + m <= 60)
+        {
+            // counts[i][j][k] is the number of orderings of i current and j baseline samples with U = k,
+            // the largest sample either is a current one above all j baseline samples or a baseline one
+            std::vector<std::vector<std::vector<double>>> counts(n + 1, std::vector<std::vector<double>>(m + 1));
+            for (std::size_t i = 0; i <= n; ++i)
+                for (std::size_t j = 0; j <= m; ++j)
+                {
+                    auto& count = counts[i][j];
+                    count.assign(i * j + 1, 0.0);
+                    if (i == 0 || j == 0)
+                    {
+                        count[0] = 1.0;
+                        continue;
+                    }
+
+                    for (std::size_t k = 0; k < counts[i - 1][j].size(); ++k)
+                        count[k + j] += counts[i - 1][j][k];
+                    for (std::size_t k = 0; k < counts[i][j - 1].size(); ++k)
+                        count[k] += counts[i][j - 1][k];
+                }
+
+            const auto& distribution = counts[n][m];
+            const double total = std::accumulate(distribution.begin(), distribution.end(), 0.0);
+            const double tail = std::accumulate(distribution.begin() + static_cast<std::ptrdiff_t>(u), distribution.end(), 0.0);
+            return tail / total;
+        }
+
+        const double size = static_cast<double>(n + m);
+        const double mean = static_cast<double>(n * m) / 2.0;
+        const double variance = static_cast<double>(n * m) / 12.0 * (size + 1.0 - ties / (size * (size - 1.0)));
+        if (variance <= 0.0) return 1.0;
+        const double z = (u - mean - 0.5) / std::sqrt(variance);
+        return 0.5 * std::erfc(z / std::sqrt(2.0));
+    }
+
+    // reports every benchmark of this run that the baseline also has, returns the number of regressions:
+    // slowdowns of the median by more than the threshold that are significant at the alpha level
+    std::size_t compare(const std::vector<Measurement>& measurements, const Samples& baseline,
+                        const Options& options, std::ostream& stream)
+    {
+        Samples current;
+        std::vector<std::string> names;
+        for (const auto& measurement : measurements)
+        {
+            auto& samples = current[measurement.name];
+            if (samples.empty()) names.push_back(measurement.name);
+            samples.push_back(measurement.realTime);
+        }
+
+        char line[160];
+        std::snprintf(line, sizeof(line), "\nComparison with %s, regressions are slowdowns by more than %.1f%% with p < %g\n",
+                      options.baseline.c_str(), options.threshold * 100.0, options.alpha);
+        stream << line;
+        std::snprintf(line, sizeof(line), "%-36s %15s %15s %9s %9s\n", "name", "baseline", "current", "change", "p");
+        stream << line;
+
+        std::size_t regressions = 0;
+        bool tooFewSamples = false;
+        for (const auto& name : names)
+        {
+            const auto i = baseline.find(name);
+            if (i == baseline.end()) continue;
+
+            const auto& before = i->second;
+            const auto& after = current[name];
+            const double baselineTime = median(before);
+            const double currentTime = median(after);
+            const double change = currentTime / baselineTime - 1.0;
+            const double p = slowdownProbability(before, after);
+
+            // the smallest p the exact test can produce is one over the number of orderings
+            double orderings = 1.0;
+            for (std::size_t k = 1; k <= before.size(); ++k)
+                orderings = orderings * static_cast<double>(after.size() + k) / static_cast<double>(k);
+            if (1.0 / orderings > options.alpha) tooFewSamples = true;
+
+            const bool regression = change > options.threshold && p < options.alpha;
+            if (regression) ++regressions;
+
+            std::snprintf(line, sizeof(line), "%-36s %12.1f ns %12.1f ns %+8.1f%% %9.4f%s\n",
+                          name.c_str(), baselineTime, currentTime, change * 100.0, p,
+                          regression ? "  REGRESSION" : "");
+            stream << line;
+        }
+
+        if (tooFewSamples)
+            stream << "Too few repetitions for a significant result, use --repetitions with at least 5\n";
+        stream << regressions << (regressions == 1 ? " regression\n" : " regressions\n");
+
+        return regressions;
+    }
+
+    std::size_t parseSize(const std::string& s)
+    {
+        std::size_t end;
+        std::size_t size = std::stoull(s, &end);
+        const std::string suffix = s.substr(end);
+        if (suffix == "K" || suffix == "k") size *= 1024;
+        else if (suffix == "M" || suffix == "m") size *= 1024 * 1024;
+        else if (!suffix.empty()) throw std::invalid_argument("Invalid size " + s);
+        return size;
+    }
+
+    void printUsage(const char* program)
+    {
+        std::cout << "Usage: " << program << " [options]\n"
+            "  --filter=REGEX    run the benchmarks whose names match the regular expression\n"
+            "  --min-time=SEC    minimum duration of each measurement (default 0.1)\n"
+            "  --max-size=BYTES  largest input size, K and M suffixes allowed (default 64M)\n"
+            "  --repetitions=N   measure every benchmark N times (default 1)\n"
+            "  --format=json     print JSON instead of a table\n"
+            "  --out=FILE        write JSON to the file and print the table\n"
+            "  --baseline=FILE   compare with the results in the file and fail on regressions\n"
+            "  --threshold=R     smallest relative slowdown that counts as a regression (default 0.05)\n"
+            "  --alpha=P         significance level of the comparison (default 0.05)\n";
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    Options options;
+
+    try
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string argument = argv[i];
+            const auto separator = argument.find('=');
+            const auto name = argument.substr(0, separator);
+            const auto value = separator == std::string::npos ? std::string{} : argument.substr(separator + 1);
+
+            if (name == "--filter") options.filter = std::regex{value};
+            else if (name == "--min-time") options.minTime = std::stod(value);
+            else if (name == "--repetitions" && std::stoul(value) > 0) options.repetitions = std::stoul(value);
+            else if (name == "--max-size") options.maxSize = parseSize(value);
+            else if (name == "--format" && (value == "json" || value == "console")) options.json = value == "json";
+            else if (name == "--out") options.output = value;
+            else if (name == "--baseline") options.baseline = value;
+            else if (name == "--threshold") options.threshold = std::stod(value);
+            else if (name == "--alpha") options.alpha = std::stod(value);
+            else
+            {
+                printUsage(argv[0]);
+                return name == "--help" ? EXIT_SUCCESS : EXIT_FAILURE;
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Invalid argument: " << e.what() << '\n';
+        return EXIT_FAILURE;
+    }
+
+    // the baseline is read first, so that a broken file does not waste a whole run
+    Samples baseline;
+    try
+    {
+        if (!options.baseline.empty()) baseline = loadSamples(options.baseline);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Failed to read the baseline: " << e.what() << '\n';
+        return EXIT_FAILURE;
+    }
+
+    Runner runner{options};
+    {
+        const auto data = randomBytes(options.maxSize);
+        benchmarkAes(runner, data);
+        benchmarkBase64(runner, data);
+        benchmarkCrc(runner, data);
+        benchmarkHashes(runner, data);
+        benchmarkHex(runner, data);
+    }
+    benchmarkUtf8(runner);
+    benchmarkUuid(runner);
+
+    if (!options.output.empty())
+    {
+        std::ofstream file{options.output};
+        writeJson(file, runner.getMeasurements());
+        if (!file)
+        {
+            std::cerr << "Failed to write " << options.output << '\n';
+            return EXIT_FAILURE;
+        }
+    }
+    else if (options.json)
+        writeJson(std::cout, runner.getMeasurements());
+
+    // keeps the report out of JSON printed to the standard output
+    if (!options.baseline.empty() &&
+        compare(runner.getMeasurements(), baseline, options, options.json && options.output.empty() ? std::cerr : std::cout))
+        return EXIT_FAILURE;
+
+    return EXIT_SUCCESS;
+}
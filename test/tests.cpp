@@ -1,16 +1,27 @@
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
+#include <functional>
+#include <list>
+#include <map>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 #include "catch2/catch.hpp"
 #include "aes.hpp"
 #include "base64.hpp"
+#include "cpu.hpp"
 #include "crc.hpp"
 #include "fnv1.hpp"
+#include "hex.hpp"
 #include "md5.hpp"
 #include "sha1.hpp"
 #include "sha2.hpp"
 #include "utf8.hpp"
 #include "uuid.hpp"
+#include "xxh3.hpp"
 
 TEST_CASE("AES", "[aes]")
 {
@@ -93,6 +104,41 @@ TEST_CASE("AES", "[aes]")
         }
     }
 
+    SECTION("Buffer")
+    {
+        std::vector<std::uint8_t> data(100);
+        for (std::size_t i = 0; i < data.size(); ++i)
+            data[i] = static_cast<std::uint8_t>(i * 7 + 3);
+
+        REQUIRE(aes::paddedSize(0) == 0);
+        REQUIRE(aes::paddedSize(1) == 16);
+        REQUIRE(aes::paddedSize(100) == 112);
+
+        // encrypting in place gives the same as the allocating overloads
+        std::vector<std::uint8_t> buffer(data);
+        buffer.resize(aes::paddedSize(data.size()));
+
+        REQUIRE(aes::encryptEcb<256>(buffer.data(), data.size(), buffer.data(), key) == buffer.size());
+        REQUIRE(buffer == aes::encryptEcb<256>(data, key));
+        REQUIRE(aes::decryptEcb<256>(buffer.data(), buffer.size(), buffer.data(), key) == buffer.size());
+        REQUIRE(std::equal(data.begin(), data.end(), buffer.begin()));
+
+        std::copy(data.begin(), data.end(), buffer.begin());
+        REQUIRE(aes::encryptCbc<256>(buffer.data(), data.size(), buffer.data(), key, initVector) == buffer.size());
+        REQUIRE(buffer == aes::encryptCbc<256>(data, key, initVector));
+        REQUIRE(aes::decryptCbc<256>(buffer.data(), buffer.size(), buffer.data(), key, initVector) == buffer.size());
+        REQUIRE(std::equal(data.begin(), data.end(), buffer.begin()));
+
+        std::copy(data.begin(), data.end(), buffer.begin());
+        REQUIRE(aes::encryptCfb<256>(buffer.data(), data.size(), buffer.data(), key, initVector) == buffer.size());
+        REQUIRE(buffer == aes::encryptCfb<256>(data, key, initVector));
+        REQUIRE(aes::decryptCfb<256>(buffer.data(), buffer.size(), buffer.data(), key, initVector) == buffer.size());
+        REQUIRE(std::equal(data.begin(), data.end(), buffer.begin()));
+
+        const std::list<std::uint8_t> list(data.begin(), data.end());
+        REQUIRE(aes::encryptCbc<128>(list, initVector, initVector) == aes::encryptCbc<128>(data, initVector, initVector));
+    }
+
     SECTION("Byte")
     {
         constexpr std::array<std::byte, 32> keyByte = {
@@ -120,6 +166,19 @@ TEST_CASE("AES", "[aes]")
     }
 }
 
+namespace
+{
+    struct Bcrypt final
+    {
+        static constexpr char chars[] = "./ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+    };
+
+    struct Imap final
+    {
+        static constexpr char chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+,";
+    };
+}
+
 TEST_CASE("Base64", "[base64]")
 {
     const struct final
@@ -169,6 +228,116 @@ TEST_CASE("Base64", "[base64]")
         REQUIRE_THROWS_AS(base64::decode("M"), base64::ParseError);
     }
 
+    SECTION("Buffer")
+    {
+        for (const auto& testCase : testCases)
+        {
+            std::string encoded(base64::encodedSize(testCase.data.size(), testCase.padding), '\0');
+            REQUIRE(base64::encode(testCase.data.data(), testCase.data.size(), &encoded[0], testCase.padding) == encoded.size());
+            REQUIRE(encoded == testCase.result);
+
+            std::vector<std::uint8_t> decoded(base64::maxDecodedSize(testCase.result.size()));
+            const auto result = base64::decode(testCase.result.data(), testCase.result.size(), decoded.data(), decoded.size());
+            REQUIRE(result.error == base64::Error::none);
+            decoded.resize(result.size);
+            REQUIRE(decoded == testCase.data);
+        }
+
+        std::uint8_t output[16];
+        const std::string invalidSymbol = "VGVzd@Ax";
+        const auto invalidSymbolResult = base64::decode(invalidSymbol.data(), invalidSymbol.size(), output, sizeof(output));
+        REQUIRE(invalidSymbolResult.error == base64::Error::invalidCharacter);
+        REQUIRE(invalidSymbolResult.position == 5);
+        REQUIRE(invalidSymbolResult.size == 3);
+
+        const std::string invalidLength = "VGVzdCAxM";
+        const auto invalidLengthResult = base64::decode(invalidLength.data(), invalidLength.size(), output, sizeof(output));
+        REQUIRE(invalidLengthResult.error == base64::Error::invalidLength);
+        REQUIRE(invalidLengthResult.position == 8);
+
+        const std::string tooSmall = "VGVzdCAxMiE=";
+        const auto tooSmallResult = base64::decode(tooSmall.data(), tooSmall.size(), output, 7);
+        REQUIRE(tooSmallResult.error == base64::Error::outputTooSmall);
+        REQUIRE(tooSmallResult.size == 6);
+        REQUIRE(tooSmallResult.position == 8);
+    }
+
+    SECTION("Streaming")
+    {
+        std::vector<std::uint8_t> data(1000);
+        for (std::size_t i = 0; i < data.size(); ++i)
+            data[i] = static_cast<std::uint8_t>(i * 37);
+
+        for (std::size_t chunk = 1; chunk < 40; chunk += 3)
+        {
+            // small output buffers force the encoder to stop early
+            base64::Encoder encoder;
+            std::string encoded;
+            char buffer[10];
+            for (std::size_t i = 0; i < data.size();)
+            {
+                const auto result = encoder.update(data.data() + i, std::min(chunk, data.size() - i), buffer, sizeof(buffer));
+                encoded.append(buffer, result.written);
+                i += result.consumed;
+            }
+            const auto last = encoder.finalize(buffer, sizeof(buffer));
+            REQUIRE(last.error == base64::Error::none);
+            encoded.append(buffer, last.written);
+            REQUIRE(encoded == base64::encode(data));
+
+            std::string wrapped;
+            for (std::size_t i = 0; i < encoded.size(); i += 76)
+                wrapped += encoded.substr(i, 76) + "\r\n";
+
+            base64::Decoder decoder(true);
+            std::vector<std::uint8_t> decoded;
+            std::uint8_t output[64];
+            for (std::size_t i = 0; i < wrapped.size();)
+            {
+                const auto result = decoder.update(wrapped.data() + i, std::min(chunk, wrapped.size() - i), output, sizeof(output));
+                REQUIRE(result.error != base64::Error::invalidCharacter);
+                decoded.insert(decoded.end(), output, output + result.written);
+                i += result.consumed;
+            }
+            const auto end = decoder.finalize(output, sizeof(output));
+            REQUIRE(end.error == base64::Error::none);
+            decoded.insert(decoded.end(), output, output + end.written);
+            REQUIRE(decoded == data);
+        }
+
+        base64::Decoder decoder;
+        std::uint8_t output[16];
+        const std::string wrapped = "VGVz\ndCAx";
+        const auto result = decoder.update(wrapped.data(), wrapped.size(), output, sizeof(output));
+        REQUIRE(result.error == base64::Error::invalidCharacter);
+        REQUIRE(result.consumed == 4);
+        REQUIRE(result.written == 3);
+
+        base64::Decoder single;
+        REQUIRE(single.update("M", 1, output, sizeof(output)).error == base64::Error::none);
+        REQUIRE(single.finalize(output, sizeof(output)).error == base64::Error::invalidLength);
+    }
+
+    SECTION("Custom Alphabet")
+    {
+        const std::vector<std::uint8_t> data = {'T', 'e', 's', 't', ' ', '1', '2', '!', 0xFF, 0xFE, 0x00};
+        const std::string bcrypt = "TETxbA.vKgF99e.";
+        REQUIRE(base64::encode<Bcrypt>(data.begin(), data.end(), false) == bcrypt);
+        REQUIRE(base64::decode<Bcrypt>(bcrypt.begin(), bcrypt.end()) == data);
+        REQUIRE(base64::decode<Bcrypt>(bcrypt.data(), bcrypt.data() + bcrypt.size()) == data);
+        const std::string invalid = "+/";
+        REQUIRE_THROWS_AS(base64::decode<Bcrypt>(invalid.begin(), invalid.end()), base64::ParseError);
+
+        std::vector<std::uint8_t> large(300);
+        for (std::size_t i = 0; i < large.size(); ++i)
+            large[i] = static_cast<std::uint8_t>(i * 7);
+
+        const auto imap = base64::encode<Imap>(large.data(), large.data() + large.size(), false);
+        REQUIRE(imap.find_first_not_of(Imap::chars) == std::string::npos);
+        REQUIRE(base64::decode<Imap>(imap.data(), imap.data() + imap.size()) == large);
+        REQUIRE(base64::decode<Imap>(imap.begin(), imap.end()) == large);
+    }
+
     SECTION("Byte")
     {
         const struct final
@@ -182,6 +351,35 @@ TEST_CASE("Base64", "[base64]")
         const auto b = base64::encode(testCaseByte.data);
         REQUIRE(b == testCaseByte.result);
     }
+
+    SECTION("Long")
+    {
+        std::vector<std::uint8_t> data;
+        for (std::size_t i = 0; i < 256; i += 4)
+            data.push_back(static_cast<std::uint8_t>(i));
+
+        const std::string result = "AAQIDBAUGBwgJCgsMDQ4PEBESExQVFhcYGRobHB0eHyAhIiMkJSYnKCkqKywtLi8wMTIzNDU2Nzg5Ojs8PT4/A==";
+        REQUIRE(base64::encode(data) == result);
+        REQUIRE(base64::decode(result) == data);
+
+        // contiguous input takes the vectorized path, std::list the scalar one
+        for (std::size_t size = 0; size < 200; ++size)
+        {
+            std::vector<std::uint8_t> v(size);
+            for (std::size_t i = 0; i < size; ++i)
+                v[i] = static_cast<std::uint8_t>(i * 97 + size);
+
+            const std::list<std::uint8_t> list(v.begin(), v.end());
+            const auto encoded = base64::encode(v);
+            REQUIRE(encoded == base64::encode(list));
+            REQUIRE(base64::decode(encoded) == v);
+            REQUIRE(base64::decode(std::list<char>(encoded.begin(), encoded.end())) == v);
+        }
+
+        std::string invalid(100, 'A');
+        invalid[70] = '_';
+        REQUIRE_THROWS_AS(base64::decode(invalid), base64::ParseError);
+    }
 }
 
 TEST_CASE("Base64 URL", "[base64url]")
@@ -233,6 +431,96 @@ TEST_CASE("Base64 URL", "[base64url]")
         REQUIRE_THROWS_AS(base64url::decode("M"), base64url::ParseError);
     }
 
+    SECTION("Buffer")
+    {
+        for (const auto& testCase : testCases)
+        {
+            std::string encoded(base64url::encodedSize(testCase.data.size(), testCase.padding), '\0');
+            REQUIRE(base64url::encode(testCase.data.data(), testCase.data.size(), &encoded[0], testCase.padding) == encoded.size());
+            REQUIRE(encoded == testCase.result);
+
+            std::vector<std::uint8_t> decoded(base64url::maxDecodedSize(testCase.result.size()));
+            const auto result = base64url::decode(testCase.result.data(), testCase.result.size(), decoded.data(), decoded.size());
+            REQUIRE(result.error == base64url::Error::none);
+            decoded.resize(result.size);
+            REQUIRE(decoded == testCase.data);
+        }
+
+        std::uint8_t output[16];
+        const std::string invalidSymbol = "VGVzd@Ax";
+        const auto invalidSymbolResult = base64url::decode(invalidSymbol.data(), invalidSymbol.size(), output, sizeof(output));
+        REQUIRE(invalidSymbolResult.error == base64url::Error::invalidCharacter);
+        REQUIRE(invalidSymbolResult.position == 5);
+        REQUIRE(invalidSymbolResult.size == 3);
+
+        const std::string invalidLength = "VGVzdCAxM";
+        const auto invalidLengthResult = base64url::decode(invalidLength.data(), invalidLength.size(), output, sizeof(output));
+        REQUIRE(invalidLengthResult.error == base64url::Error::invalidLength);
+        REQUIRE(invalidLengthResult.position == 8);
+
+        const std::string tooSmall = "VGVzdCAxMiE=";
+        const auto tooSmallResult = base64url::decode(tooSmall.data(), tooSmall.size(), output, 7);
+        REQUIRE(tooSmallResult.error == base64url::Error::outputTooSmall);
+        REQUIRE(tooSmallResult.size == 6);
+        REQUIRE(tooSmallResult.position == 8);
+    }
+
+    SECTION("Streaming")
+    {
+        std::vector<std::uint8_t> data(1000);
+        for (std::size_t i = 0; i < data.size(); ++i)
+            data[i] = static_cast<std::uint8_t>(i * 37);
+
+        for (std::size_t chunk = 1; chunk < 40; chunk += 3)
+        {
+            // small output buffers force the encoder to stop early
+            base64url::Encoder encoder;
+            std::string encoded;
+            char buffer[10];
+            for (std::size_t i = 0; i < data.size();)
+            {
+                const auto result = encoder.update(data.data() + i, std::min(chunk, data.size() - i), buffer, sizeof(buffer));
+                encoded.append(buffer, result.written);
+                i += result.consumed;
+            }
+            const auto last = encoder.finalize(buffer, sizeof(buffer));
+            REQUIRE(last.error == base64url::Error::none);
+            encoded.append(buffer, last.written);
+            REQUIRE(encoded == base64url::encode(data));
+
+            std::string wrapped;
+            for (std::size_t i = 0; i < encoded.size(); i += 76)
+                wrapped += encoded.substr(i, 76) + "\r\n";
+
+            base64url::Decoder decoder(true);
+            std::vector<std::uint8_t> decoded;
+            std::uint8_t output[64];
+            for (std::size_t i = 0; i < wrapped.size();)
+            {
+                const auto result = decoder.update(wrapped.data() + i, std::min(chunk, wrapped.size() - i), output, sizeof(output));
+                REQUIRE(result.error != base64url::Error::invalidCharacter);
+                decoded.insert(decoded.end(), output, output + result.written);
+                i += result.consumed;
+            }
+            const auto end = decoder.finalize(output, sizeof(output));
+            REQUIRE(end.error == base64url::Error::none);
+            decoded.insert(decoded.end(), output, output + end.written);
+            REQUIRE(decoded == data);
+        }
+
+        base64url::Decoder decoder;
+        std::uint8_t output[16];
+        const std::string wrapped = "VGVz\ndCAx";
+        const auto result = decoder.update(wrapped.data(), wrapped.size(), output, sizeof(output));
+        REQUIRE(result.error == base64url::Error::invalidCharacter);
+        REQUIRE(result.consumed == 4);
+        REQUIRE(result.written == 3);
+
+        base64url::Decoder single;
+        REQUIRE(single.update("M", 1, output, sizeof(output)).error == base64url::Error::none);
+        REQUIRE(single.finalize(output, sizeof(output)).error == base64url::Error::invalidLength);
+    }
+
     SECTION("Byte")
     {
         const struct final
@@ -246,6 +534,78 @@ TEST_CASE("Base64 URL", "[base64url]")
         const auto b = base64url::encode(testCaseByte.data);
         REQUIRE(b == testCaseByte.result);
     }
+
+    SECTION("Long")
+    {
+        std::vector<std::uint8_t> data;
+        for (std::size_t i = 0; i < 256; i += 4)
+            data.push_back(static_cast<std::uint8_t>(i));
+
+        const std::string result = "AAQIDBAUGBwgJCgsMDQ4PEBESExQVFhcYGRobHB0eHyAhIiMkJSYnKCkqKywtLi8wMTIzNDU2Nzg5Ojs8PT4_A==";
+        REQUIRE(base64url::encode(data) == result);
+        REQUIRE(base64url::decode(result) == data);
+
+        // contiguous input takes the vectorized path, std::list the scalar one
+        for (std::size_t size = 0; size < 200; ++size)
+        {
+            std::vector<std::uint8_t> v(size);
+            for (std::size_t i = 0; i < size; ++i)
+                v[i] = static_cast<std::uint8_t>(i * 97 + size);
+
+            const std::list<std::uint8_t> list(v.begin(), v.end());
+            const auto encoded = base64url::encode(v);
+            REQUIRE(encoded == base64url::encode(list));
+            REQUIRE(base64url::decode(encoded) == v);
+            REQUIRE(base64url::decode(std::list<char>(encoded.begin(), encoded.end())) == v);
+        }
+
+        std::string invalid(100, 'A');
+        invalid[70] = '/';
+        REQUIRE_THROWS_AS(base64url::decode(invalid), base64url::ParseError);
+    }
+}
+
+TEST_CASE("CPU", "[cpu]")
+{
+    using cpu::Feature;
+    const Feature all = Feature::sse2 | Feature::ssse3 | Feature::sse41 | Feature::sse42 |
+        Feature::avx | Feature::avx2 | Feature::avx512f | Feature::avx512bw | Feature::avx512vl |
+        Feature::aes | Feature::pclmul | Feature::sha;
+
+    SECTION("Settings")
+    {
+        REQUIRE(cpu::applySetting(all, "") == all);
+        REQUIRE(cpu::applySetting(all, "avx512") == all);
+        REQUIRE(cpu::applySetting(all, "scalar") == Feature::none);
+        REQUIRE(cpu::applySetting(all, "sse2") == (Feature::sse2 | Feature::aes | Feature::pclmul | Feature::sha));
+        REQUIRE(cpu::applySetting(all, "ssse3,-aes,-sha") == (Feature::sse2 | Feature::ssse3 | Feature::pclmul));
+        REQUIRE(cpu::applySetting(all, "-avx2") == (all & ~Feature::avx2));
+        REQUIRE(cpu::applySetting(all, "avx2,unknown,-unknown") ==
+                (all & ~(Feature::avx512f | Feature::avx512bw | Feature::avx512vl)));
+        REQUIRE(cpu::applySetting(Feature::sse2, "avx2") == Feature::sse2);
+    }
+
+    SECTION("Tier")
+    {
+        const auto tier = cpu::getTier();
+        REQUIRE(cpu::hasFeatures(Feature::none));
+        REQUIRE(cpu::hasFeatures(Feature::avx2) == (tier >= cpu::Tier::avx2));
+        REQUIRE(cpu::hasFeatures(Feature::ssse3) == (tier >= cpu::Tier::ssse3));
+        REQUIRE(cpu::getName(cpu::Tier::scalar) == "scalar");
+        REQUIRE(cpu::getName(cpu::Tier::avx512) == "avx512");
+    }
+
+    SECTION("Select")
+    {
+        using Function = int (*)();
+        const Function scalar = [] { return 0; };
+        const Function vector = [] { return 1; };
+        const Function impossible = [] { return 2; };
+
+        REQUIRE(cpu::select<Function>({{Feature::none, vector}}, scalar)() == 1);
+        REQUIRE(cpu::select<Function>({{static_cast<Feature>(1U << 31), impossible}}, scalar)() == 0);
+        REQUIRE(cpu::select<Function>({}, scalar)() == 0);
+    }
 }
 
 TEST_CASE("CRC8", "[crc8]")
@@ -368,6 +728,85 @@ TEST_CASE("CRC32", "[crc32]")
     }
 }
 
+TEST_CASE("CRC Engine", "[crc]")
+{
+    const std::string check = "123456789";
+
+    SECTION("Check")
+    {
+        REQUIRE(crc::Crc8::generate(check) == 0xF4U);
+        REQUIRE(crc::Crc16Kermit::generate(check) == 0x2189U);
+        REQUIRE(crc::Crc16Ccitt::generate(check) == 0x29B1U);
+        REQUIRE(crc::Crc16Xmodem::generate(check) == 0x31C3U);
+        REQUIRE(crc::Crc32::generate(check) == 0xCBF43926U);
+        REQUIRE(crc::Crc32c::generate(check) == 0xE3069283U);
+        REQUIRE(crc::Crc64Ecma::generate(check) == 0x6C40DF5F0B497347ULL);
+        REQUIRE(crc::Crc64Xz::generate(check) == 0x995DC9BBDF1939FAULL);
+        REQUIRE(crc::Crc64Nvme::generate(check) == 0xAE8B14860A799888ULL);
+        REQUIRE(crc::generate<std::uint64_t>(check) == 0x995DC9BBDF1939FAULL);
+        REQUIRE(crc::generate<std::uint64_t>(check.data(), check.size()) == 0x995DC9BBDF1939FAULL);
+        REQUIRE(crc::Crc32c::generate(check.data(), check.size()) == 0xE3069283U);
+    }
+
+    SECTION("Odd Width")
+    {
+        REQUIRE((crc::Engine<5, 0x05U, 0x1FU, true, true, 0x1FU>::generate(check)) == 0x19U); // CRC-5/USB
+        REQUIRE((crc::Engine<12, 0x80FU, 0x000U, false, true, 0x000U>::generate(check)) == 0xDAFU); // CRC-12/UMTS
+        REQUIRE((crc::Engine<24, 0x864CFBU, 0xB704CEU, false, false, 0x000000U>::generate(check)) == 0x21CF02U); // CRC-24/OPENPGP
+    }
+
+    SECTION("Slicing")
+    {
+        std::vector<std::uint8_t> data(1000);
+        for (std::size_t i = 0; i < data.size(); ++i)
+            data[i] = static_cast<std::uint8_t>(i * 7 + 3);
+
+        const std::list<std::uint8_t> list(data.begin(), data.end());
+
+        REQUIRE(crc::Crc16Ccitt::generate(data) == crc::Crc16Ccitt::generate(list));
+        REQUIRE(crc::Crc32c::generate(data) == crc::Crc32c::generate(list));
+        REQUIRE(crc::Crc64Ecma::generate(data) == crc::Crc64Ecma::generate(list));
+        REQUIRE(crc::Crc64Xz::generate(data) == crc::Crc64Xz::generate(list));
+    }
+
+    SECTION("Folding")
+    {
+        std::vector<std::uint8_t> data(1024);
+        for (std::size_t i = 0; i < data.size(); ++i)
+            data[i] = static_cast<std::uint8_t>(i * 131 + (i >> 3));
+
+        for (std::size_t size = 0; size <= data.size(); size += 13)
+        {
+            const std::list<std::uint8_t> list(data.begin(), data.begin() + static_cast<std::ptrdiff_t>(size));
+            const std::vector<std::uint8_t> vector(data.begin(), data.begin() + static_cast<std::ptrdiff_t>(size));
+
+            REQUIRE(crc::Crc64Ecma::generate(vector) == crc::Crc64Ecma::generate(list));
+            REQUIRE(crc::Crc64Xz::generate(vector) == crc::Crc64Xz::generate(list));
+            REQUIRE(crc::Crc64Nvme::generate(vector) == crc::Crc64Nvme::generate(list));
+            REQUIRE(crc::generate<std::uint64_t>(vector) == crc::generate<std::uint64_t>(list));
+        }
+    }
+
+    SECTION("Update")
+    {
+        std::vector<std::uint8_t> data(100);
+        for (std::size_t i = 0; i < data.size(); ++i)
+            data[i] = static_cast<std::uint8_t>(i);
+
+        auto state = crc::Crc64Ecma::getInitialState();
+        state = crc::Crc64Ecma::update(state, data.begin(), data.begin() + 33);
+        state = crc::Crc64Ecma::update(state, data.begin() + 33, data.end());
+        REQUIRE(crc::Crc64Ecma::finalize(state) == crc::Crc64Ecma::generate(data));
+    }
+
+    SECTION("Constexpr")
+    {
+        constexpr std::array<char, 9> data = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+        static_assert(crc::Crc32::generate(data) == 0xCBF43926U);
+        static_assert(crc::generate<std::uint32_t>(data) == 0xCBF43926U);
+    }
+}
+
 TEST_CASE("FNV1 32", "[fnv132]")
 {
     SECTION("Hash")
@@ -448,6 +887,253 @@ TEST_CASE("FNV1 64", "[fnv164]")
     }
 }
 
+TEST_CASE("FNV1a", "[fnv1a]")
+{
+    SECTION("Hash")
+    {
+        const struct final
+        {
+            std::string data;
+            std::uint32_t result32;
+            std::uint64_t result64;
+        } testCases[] = {
+            {"", 0x811C9DC5U, 0xCBF29CE484222325ULL},
+            {"a", 0xE40C292CU, 0xAF63DC4C8601EC8CULL},
+            {"foobar", 0xBF9CF968U, 0x85944171F73967E8ULL}
+        };
+
+        for (const auto& testCase : testCases)
+        {
+            REQUIRE(fnv1a::hash<std::uint32_t>(testCase.data) == testCase.result32);
+            REQUIRE(fnv1a::hash<std::uint64_t>(testCase.data) == testCase.result64);
+        }
+    }
+
+    SECTION("Long")
+    {
+        std::vector<std::uint8_t> data(1000003);
+        for (std::size_t i = 0; i < data.size(); ++i)
+            data[i] = static_cast<std::uint8_t>(i * 13);
+
+        const std::list<std::uint8_t> list(data.begin(), data.end());
+
+        REQUIRE(fnv1::hash<std::uint64_t>(data) == fnv1::hash<std::uint64_t>(list));
+        REQUIRE(fnv1a::hash<std::uint64_t>(data) == fnv1a::hash<std::uint64_t>(list));
+        REQUIRE(fnv1a::hash<std::uint32_t>(data.data(), data.data() + data.size()) == fnv1a::hash<std::uint32_t>(list));
+        REQUIRE(fnv1a::hash<std::uint64_t>(data.data(), data.size()) == fnv1a::hash<std::uint64_t>(list));
+        REQUIRE(fnv1::hash<std::uint32_t>(data.data(), data.size()) == fnv1::hash<std::uint32_t>(list));
+    }
+
+    SECTION("Constexpr")
+    {
+        constexpr std::array<char, 6> data = {'f', 'o', 'o', 'b', 'a', 'r'};
+        static_assert(fnv1a::hash<std::uint64_t>(data) == 0x85944171F73967E8ULL);
+    }
+}
+
+namespace
+{
+    int dispatch(const std::string_view command)
+    {
+        using namespace fnv1a::literals;
+
+        switch (fnv1a::hash<std::uint64_t>(command))
+        {
+            case "GET"_fnv1a64: return 1;
+            case "PUT"_fnv1a64: return 2;
+            case "DELETE"_fnv1a64: return 3;
+            default: return 0;
+        }
+    }
+}
+
+TEST_CASE("FNV1 Literals", "[fnv1literals]")
+{
+    using namespace fnv1::literals;
+    using namespace fnv1a::literals;
+
+    SECTION("Literals")
+    {
+        static_assert("foobar"_fnv1a32 == 0xBF9CF968U);
+        static_assert("foobar"_fnv1a64 == 0x85944171F73967E8ULL);
+        static_assert("0"_fnv132 == 0x050C5D2FU);
+        static_assert("0"_fnv164 == 0xAF63BD4C8601B7EFULL);
+    }
+
+    SECTION("Switch")
+    {
+        REQUIRE(dispatch("GET") == 1);
+        REQUIRE(dispatch("PUT") == 2);
+        REQUIRE(dispatch("DELETE") == 3);
+        REQUIRE(dispatch("POST") == 0);
+    }
+
+    SECTION("Hash")
+    {
+        const fnv1a::Hash<> hasher;
+        const std::string key = "content-type";
+        REQUIRE(hasher(key) == hasher(std::string_view(key)));
+        REQUIRE(hasher("content-type") == static_cast<std::size_t>(fnv1a::hash<std::uint64_t>(key)));
+
+        std::unordered_map<std::string, int, fnv1::Hash<>, std::equal_to<>> map = {{"a", 1}, {"b", 2}};
+        REQUIRE(map.at("b") == 2);
+    }
+}
+
+TEST_CASE("Hex", "[hex]")
+{
+    const struct final
+    {
+        std::vector<std::uint8_t> data;
+        bool uppercase;
+        std::string result;
+    } testCases[] = {
+        {{}, false, ""},
+        {{0x00}, false, "00"},
+        {{0x0F, 0xF0}, false, "0ff0"},
+        {{0x0F, 0xF0}, true, "0FF0"},
+        {{'T', 'e', 's', 't', ' ', '1', '2', '!'}, false, "5465737420313221"},
+        {{0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF}, true, "0123456789ABCDEF"}
+    };
+
+    SECTION("Encoding")
+    {
+        for (const auto& testCase : testCases)
+        {
+            REQUIRE(hex::encode(testCase.data, testCase.uppercase) == testCase.result);
+            const std::list<std::uint8_t> list(testCase.data.begin(), testCase.data.end());
+            REQUIRE(hex::encode(list, testCase.uppercase) == testCase.result);
+        }
+    }
+
+    SECTION("Decoding")
+    {
+        for (const auto& testCase : testCases)
+        {
+            REQUIRE(hex::decode(testCase.result) == testCase.data);
+            const std::list<char> list(testCase.result.begin(), testCase.result.end());
+            REQUIRE(hex::decode(list) == testCase.data);
+        }
+
+        REQUIRE(hex::decode("aBcD") == std::vector<std::uint8_t>{0xAB, 0xCD});
+    }
+
+    SECTION("Errors")
+    {
+        REQUIRE_THROWS_AS(hex::decode("0g"), hex::ParseError);
+        REQUIRE_THROWS_AS(hex::decode("012"), hex::ParseError);
+        REQUIRE_THROWS_AS(hex::decode(std::list<char>{'0', '1', '2'}), hex::ParseError);
+
+        std::uint8_t output[4];
+        const std::string invalid = "01:3";
+        const auto invalidResult = hex::decode(invalid.data(), invalid.size(), output, sizeof(output));
+        REQUIRE(invalidResult.error == hex::Error::invalidCharacter);
+        REQUIRE(invalidResult.position == 2);
+        REQUIRE(invalidResult.size == 1);
+
+        const std::string odd = "01234";
+        REQUIRE(hex::decode(odd.data(), odd.size(), output, sizeof(output)).error == hex::Error::invalidLength);
+        REQUIRE(hex::decode(odd.data(), odd.size(), output, 1).error == hex::Error::outputTooSmall);
+    }
+
+    SECTION("Long")
+    {
+        // contiguous input takes the vectorized path, std::list the scalar one
+        for (std::size_t size = 0; size < 200; ++size)
+        {
+            std::vector<std::uint8_t> data(size);
+            for (std::size_t i = 0; i < size; ++i)
+                data[i] = static_cast<std::uint8_t>(i * 97 + size);
+
+            const std::list<std::uint8_t> list(data.begin(), data.end());
+            const auto lower = hex::encode(data);
+            const auto upper = hex::encode(data, true);
+            REQUIRE(lower == hex::encode(list));
+            REQUIRE(upper == hex::encode(list, true));
+            REQUIRE(hex::decode(lower) == data);
+            REQUIRE(hex::decode(upper) == data);
+        }
+
+        std::string invalid(200, 'a');
+        invalid[150] = 'g';
+        REQUIRE_THROWS_AS(hex::decode(invalid), hex::ParseError);
+    }
+
+    SECTION("Digest")
+    {
+        const std::string data = "The quick brown fox jumps over the lazy dog";
+        const auto sha = hex::toHex(sha256::hash(data));
+        REQUIRE(std::string(sha.begin(), sha.end()) == "d7a8fbb307d7809469ca9abcb0082e4f8d5651e46d3cdb762d02d0bf37c9e592");
+
+        const auto md = hex::toHex(md5::hash(data), true);
+        REQUIRE(std::string(md.begin(), md.end()) == "9E107D9D372BB6826BD81D3542A419D6");
+    }
+}
+
+TEST_CASE("XXH3", "[xxh3]")
+{
+    std::vector<std::uint8_t> data(5000);
+    for (std::size_t i = 0; i < data.size(); ++i)
+        data[i] = static_cast<std::uint8_t>(i * 7 + i / 13);
+
+    const struct final
+    {
+        std::size_t size;
+        std::uint64_t result64;
+        std::uint64_t result64Seeded; // seed 42
+        xxh3::Hash128 result128;
+    } testCases[] = {
+        {0, 0x2D06800538D394C2ULL, 0xB029411FF43D84D2ULL, {0x6001C324468D497FULL, 0x99AA06D3014798D8ULL}},
+        {3, 0xC3489259E968AD9EULL, 0x534CAA7AE6CCF938ULL, {0xC3489259E968AD9EULL, 0x656E81C56E41FE02ULL}},
+        {8, 0xB88DEE77F6BF6980ULL, 0x7B954FC823483166ULL, {0xEBABBD0695002FF6ULL, 0xE4B9DD0B66FF3C50ULL}},
+        {16, 0x907976BB290DB9E8ULL, 0x348E1B241ED4181BULL, {0xEB7825B4BB2F744EULL, 0x23C9692DC06EA6FCULL}},
+        {100, 0x648C415AB999008EULL, 0x846331825E142BACULL, {0x870769FE0E9F581DULL, 0xAF13948B337C6996ULL}},
+        {200, 0x3F99FC17FCC9950DULL, 0xE64DE6A1DC4445CEULL, {0xFF2F99AE3DEFDEC0ULL, 0x50EA403D60A8D077ULL}},
+        {1000, 0xE289E91F8BC3E496ULL, 0x854C89BEA966612EULL, {0xE289E91F8BC3E496ULL, 0x4EB4DD31555CEDEDULL}},
+        {5000, 0xE0969AE2B59AAFCCULL, 0xC70AA8BD38AD6021ULL, {0xE0969AE2B59AAFCCULL, 0x703D74216A88C98DULL}}
+    };
+
+    SECTION("Hash")
+    {
+        for (const auto& testCase : testCases)
+        {
+            const std::vector<std::uint8_t> v(data.begin(), data.begin() + static_cast<std::ptrdiff_t>(testCase.size));
+            REQUIRE(xxh3::hash<std::uint64_t>(v) == testCase.result64);
+            REQUIRE(xxh3::hash<std::uint64_t>(v, 42) == testCase.result64Seeded);
+            REQUIRE(xxh3::hash<xxh3::Hash128>(v) == testCase.result128);
+        }
+
+        const std::string s = "Test 12!";
+        REQUIRE(xxh3::hash<std::uint64_t>(s) == 0x574729514805EC61ULL);
+    }
+
+    SECTION("Streaming")
+    {
+        for (const auto& testCase : testCases)
+            for (const std::size_t step : {1, 63, 64, 255, 256, 1000})
+            {
+                xxh3::Hasher hasher;
+                xxh3::Hasher seededHasher(42);
+                for (std::size_t i = 0; i < testCase.size; i += step)
+                {
+                    const auto end = data.data() + std::min(testCase.size, i + step);
+                    hasher.update(data.data() + i, end);
+                    seededHasher.update(data.data() + i, end);
+                }
+
+                REQUIRE(hasher.finalize<std::uint64_t>() == testCase.result64);
+                REQUIRE(hasher.finalize<xxh3::Hash128>() == testCase.result128);
+                REQUIRE(seededHasher.finalize<std::uint64_t>() == testCase.result64Seeded);
+            }
+    }
+
+    SECTION("Iterator")
+    {
+        const std::list<std::uint8_t> list(data.begin(), data.end());
+        REQUIRE(xxh3::hash<std::uint64_t>(list) == 0xE0969AE2B59AAFCCULL);
+    }
+}
+
 namespace
 {
     template <class T>
@@ -504,6 +1190,13 @@ TEST_CASE("MD5", "[md5]")
             const auto h = md5::hash(testCase.data);
             const auto str = toString(h);
             REQUIRE(str == testCase.result);
+
+            // the same data in two parts, finalizing in between does not change the state
+            md5::Hasher hasher;
+            hasher.update(testCase.data.begin(), testCase.data.begin() + testCase.data.size() / 3);
+            hasher.finalize();
+            hasher.update(testCase.data.begin() + testCase.data.size() / 3, testCase.data.end());
+            REQUIRE(hasher.finalize() == h);
         }
     }
 
@@ -521,6 +1214,23 @@ TEST_CASE("MD5", "[md5]")
         const auto str = toString(h);
         REQUIRE(str == testCase.result);
     }
+
+    SECTION("Buffer")
+    {
+        std::vector<std::uint8_t> data(1000);
+        for (std::size_t i = 0; i < data.size(); ++i)
+            data[i] = static_cast<std::uint8_t>(i * 131 + (i >> 3));
+
+        const auto h = md5::hash(std::list<std::uint8_t>(data.begin(), data.end()));
+        REQUIRE(md5::hash(data.data(), data.size()) == h);
+        REQUIRE(md5::hash(data) == h);
+
+        // chunks that start and end at every offset within a block
+        md5::Hasher hasher;
+        for (std::size_t offset = 0, chunk = 1; offset < data.size(); offset += chunk, chunk = chunk * 7 % 131 + 1)
+            hasher.update(data.data() + offset, std::min(chunk, data.size() - offset));
+        REQUIRE(hasher.finalize() == h);
+    }
 }
 
 TEST_CASE("SHA1", "[sha1]")
@@ -561,6 +1271,13 @@ TEST_CASE("SHA1", "[sha1]")
             const auto h = sha1::hash(testCase.data);
             const auto str = toString(h);
             REQUIRE(str == testCase.result);
+
+            // the same data in two parts, finalizing in between does not change the state
+            sha1::Hasher hasher;
+            hasher.update(testCase.data.begin(), testCase.data.begin() + testCase.data.size() / 3);
+            hasher.finalize();
+            hasher.update(testCase.data.begin() + testCase.data.size() / 3, testCase.data.end());
+            REQUIRE(hasher.finalize() == h);
         }
     }
 
@@ -578,6 +1295,23 @@ TEST_CASE("SHA1", "[sha1]")
         const auto str = toString(h);
         REQUIRE(str == testCase.result);
     }
+
+    SECTION("Buffer")
+    {
+        std::vector<std::uint8_t> data(1000);
+        for (std::size_t i = 0; i < data.size(); ++i)
+            data[i] = static_cast<std::uint8_t>(i * 131 + (i >> 3));
+
+        const auto h = sha1::hash(std::list<std::uint8_t>(data.begin(), data.end()));
+        REQUIRE(sha1::hash(data.data(), data.size()) == h);
+        REQUIRE(sha1::hash(data) == h);
+
+        // chunks that start and end at every offset within a block
+        sha1::Hasher hasher;
+        for (std::size_t offset = 0, chunk = 1; offset < data.size(); offset += chunk, chunk = chunk * 7 % 131 + 1)
+            hasher.update(data.data() + offset, std::min(chunk, data.size() - offset));
+        REQUIRE(hasher.finalize() == h);
+    }
 }
 
 TEST_CASE("SHA256", "[sha256]")
@@ -635,6 +1369,23 @@ TEST_CASE("SHA256", "[sha256]")
         const auto str = toString(h);
         REQUIRE(str == testCase.result);
     }
+
+    SECTION("Buffer")
+    {
+        std::vector<std::uint8_t> data(1000);
+        for (std::size_t i = 0; i < data.size(); ++i)
+            data[i] = static_cast<std::uint8_t>(i * 131 + (i >> 3));
+
+        const auto h = sha256::hash(std::list<std::uint8_t>(data.begin(), data.end()));
+        REQUIRE(sha256::hash(data.data(), data.size()) == h);
+        REQUIRE(sha256::hash(data) == h);
+
+        // chunks that start and end at every offset within a block
+        sha256::Hasher hasher;
+        for (std::size_t offset = 0, chunk = 1; offset < data.size(); offset += chunk, chunk = chunk * 7 % 131 + 1)
+            hasher.update(data.data() + offset, std::min(chunk, data.size() - offset));
+        REQUIRE(hasher.finalize() == h);
+    }
 }
 
 TEST_CASE("UTF8", "[utf8]")
@@ -658,6 +1409,61 @@ TEST_CASE("UTF8", "[utf8]")
         }
     }
 
+    SECTION("Encoding into a buffer")
+    {
+        for (const auto& testCase : testCases)
+        {
+            const auto length = utf8::utf8Length(testCase.data.data(), testCase.data.size());
+            REQUIRE(length.error == utf8::Error::none);
+            REQUIRE(length.size == testCase.result.size());
+
+            std::string bytes(length.size, '\0');
+            const auto result = utf8::fromUtf32(testCase.data.data(), testCase.data.size(), &bytes[0], bytes.size());
+            REQUIRE(result.error == utf8::Error::none);
+            REQUIRE(result.size == bytes.size());
+            REQUIRE(bytes == testCase.result);
+        }
+
+        char bytes[4];
+        REQUIRE(utf8::fromUtf32(U'€', bytes) == 3);
+        REQUIRE(std::string(bytes, 3) == "\xE2\x82\xAC");
+        REQUIRE(utf8::fromUtf32(0x10FFFF, bytes) == 4);
+        REQUIRE(utf8::fromUtf32(0xD800, bytes) == 0);
+        REQUIRE(utf8::fromUtf32(0x110000, bytes) == 0);
+
+        // surrogates and values above U+10FFFF
+        for (const char32_t invalidCase : {char32_t(0xD800), char32_t(0xDFFF), char32_t(0x110000), char32_t(0xFFFFFFFF)})
+        {
+            REQUIRE_THROWS_AS(utf8::fromUtf32(invalidCase), utf8::ParseError);
+
+            std::u32string text(64, U'a');
+            text.insert(text.begin() + 33, invalidCase);
+            REQUIRE_THROWS_AS(utf8::fromUtf32(text), utf8::ParseError);
+            REQUIRE_THROWS_AS(utf8::fromUtf32(std::list<char32_t>(text.begin(), text.end())), utf8::ParseError);
+
+            const auto length = utf8::utf8Length(text.data(), text.size());
+            REQUIRE(length.error == utf8::Error::invalidSequence);
+            REQUIRE(length.position == 33);
+            REQUIRE(length.size == 33);
+        }
+
+        // a full buffer stops at a code point boundary
+        const std::u32string text = U"abé€";
+        char small[5];
+        const auto partial = utf8::fromUtf32(text.data(), text.size(), small, sizeof(small));
+        REQUIRE(partial.error == utf8::Error::outputTooSmall);
+        REQUIRE(partial.size == 4);
+        REQUIRE(partial.position == 3);
+
+        // long runs of one-, two- and multi-byte code points
+        std::u32string codePoints;
+        for (std::size_t i = 0; i < 300; ++i)
+            codePoints += std::u32string(i % 40, static_cast<char32_t>(i % 3 == 0 ? 'a' + i % 26 : i % 3 == 1 ? 0x80 + i * 7 : 0x800 + i * 3001));
+
+        REQUIRE(utf8::fromUtf32(codePoints) == utf8::fromUtf32(std::list<char32_t>(codePoints.begin(), codePoints.end())));
+        REQUIRE(utf8::toUtf32(utf8::fromUtf32(codePoints)) == codePoints);
+    }
+
     SECTION("Decoding")
     {
         for (const auto& testCase : testCases)
@@ -670,6 +1476,342 @@ TEST_CASE("UTF8", "[utf8]")
                 REQUIRE(utf32String[i] == testCase.data[i]);
         }
     }
+
+    SECTION("Invalid")
+    {
+        const std::string invalidCases[] = {
+            "\x80", // stray continuation byte
+            "a\xBF", // stray continuation byte
+            "\xC3", // truncated
+            "\xE2\x82", // truncated
+            "\xF0\x9F\x98", // truncated
+            "\xC3\x28", // missing continuation byte
+            "\xC0\xAF", // overlong
+            "\xE0\x80\xAF", // overlong
+            "\xF0\x80\x80\xAF", // overlong
+            "\xED\xA0\x80", // surrogate
+            "\xED\xBF\xBF", // surrogate
+            "\xF4\x90\x80\x80", // above U+10FFFF
+            "\xF8\x88\x80\x80\x80", // invalid lead byte
+            "\xFF"
+        };
+
+        for (const auto& invalidCase : invalidCases)
+        {
+            REQUIRE_THROWS_AS(utf8::toUtf32(invalidCase), utf8::ParseError);
+            REQUIRE_THROWS_AS(utf8::toUtf32(std::list<char>(invalidCase.begin(), invalidCase.end())), utf8::ParseError);
+
+            // the same sequence inside a long ASCII string and at a block boundary
+            for (const std::size_t offset : {std::size_t(0), std::size_t(15), std::size_t(31), std::size_t(62), std::size_t(100)})
+            {
+                std::string text(128, 'a');
+                text.insert(offset, invalidCase);
+                REQUIRE_THROWS_AS(utf8::toUtf32(text), utf8::ParseError);
+            }
+        }
+
+        REQUIRE(utf8::toUtf32(std::string("\xED\x9F\xBF\xEE\x80\x80\xF4\x8F\xBF\xBF")) == std::u32string{0xD7FF, 0xE000, 0x10FFFF});
+    }
+
+    SECTION("Long")
+    {
+        // contiguous input takes the vectorized path, std::list the scalar one
+        std::string text;
+        for (std::size_t i = 0; i < 100; ++i)
+        {
+            text += std::string(i % 40, 'a');
+            text += utf8::fromUtf32(static_cast<char32_t>(0x80 + i * 997 % 0xD000));
+            text += utf8::fromUtf32(static_cast<char32_t>(0x10000 + i * 7919));
+        }
+
+        const auto utf32String = utf8::toUtf32(text);
+        REQUIRE(utf32String == utf8::toUtf32(std::list<char>(text.begin(), text.end())));
+        REQUIRE(utf8::fromUtf32(utf32String) == text);
+    }
+
+    SECTION("Decoding into a buffer")
+    {
+        std::string text;
+        for (std::size_t i = 0; i < 100; ++i)
+        {
+            text += std::string(i % 40, 'a');
+            text += utf8::fromUtf32(static_cast<char32_t>(0x80 + i * 997 % 0xD000));
+        }
+
+        const auto count = utf8::countCodePoints(text);
+        std::u32string codePoints(count.size, U'\0');
+        const auto result = utf8::toUtf32(text.data(), text.size(), &codePoints[0], codePoints.size());
+        REQUIRE(result.error == utf8::Error::none);
+        REQUIRE(result.size == codePoints.size());
+        REQUIRE(result.position == text.size());
+        REQUIRE(codePoints == utf8::toUtf32(text));
+
+        // a full buffer stops at a code point boundary
+        const std::string small = "ab\xC3\xA9\xE2\x82\xAC";
+        char32_t output[3];
+        const auto partial = utf8::toUtf32(small.data(), small.size(), output, 3);
+        REQUIRE(partial.error == utf8::Error::outputTooSmall);
+        REQUIRE(partial.size == 3);
+        REQUIRE(partial.position == 4);
+        REQUIRE(output[2] == 0xE9);
+
+        const std::string invalid = std::string(40, 'a') + "\xC3\x28";
+        char32_t buffer[64];
+        const auto error = utf8::toUtf32(invalid.data(), invalid.size(), buffer, 64);
+        REQUIRE(error.error == utf8::Error::invalidSequence);
+        REQUIRE(error.size == 40);
+        REQUIRE(error.position == 40);
+    }
+
+    SECTION("Validation")
+    {
+        const struct final
+        {
+            std::string data;
+            utf8::Error error;
+            std::size_t position;
+            std::size_t count;
+        } validationCases[] = {
+            {"", utf8::Error::none, 0, 0},
+            {"abc", utf8::Error::none, 3, 3},
+            {"a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80", utf8::Error::none, 10, 4},
+            {"ab\x80", utf8::Error::invalidSequence, 2, 2},
+            {"a\xC3\xA9\xED\xA0\x80", utf8::Error::invalidSequence, 3, 2},
+            {"a\xF0\x9F\x98", utf8::Error::invalidSequence, 1, 1},
+            {std::string(40, 'a') + "\xE2\x82" + std::string(40, 'a'), utf8::Error::invalidSequence, 40, 40},
+            {std::string(31, 'a') + "\xC3" + std::string(32, 'a'), utf8::Error::invalidSequence, 31, 31},
+            {std::string(30, 'a') + "\xC0\x80", utf8::Error::invalidSequence, 30, 30}
+        };
+
+        for (const auto& validationCase : validationCases)
+        {
+            const auto result = utf8::validate(validationCase.data);
+            REQUIRE(result.error == validationCase.error);
+            REQUIRE(result.position == validationCase.position);
+
+            const auto count = utf8::countCodePoints(validationCase.data);
+            REQUIRE(count.error == validationCase.error);
+            REQUIRE(count.position == validationCase.position);
+            REQUIRE(count.size == validationCase.count);
+
+            const std::list<char> list(validationCase.data.begin(), validationCase.data.end());
+            REQUIRE(utf8::validate(list).position == validationCase.position);
+            REQUIRE(utf8::countCodePoints(list).size == validationCase.count);
+        }
+
+        std::string text;
+        for (std::size_t i = 0; i < 1000; ++i)
+            text += utf8::fromUtf32(static_cast<char32_t>(i % 3 ? 'a' + i % 26 : 0x400 + i));
+
+        REQUIRE(utf8::validate(text.data(), text.size()).error == utf8::Error::none);
+        REQUIRE(utf8::countCodePoints(text.data(), text.size()).size == 1000);
+    }
+
+    SECTION("View")
+    {
+        const std::string text = "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80z";
+        const utf8::View view{text};
+
+        REQUIRE(std::u32string(view.begin(), view.end()) == utf8::toUtf32(text));
+        REQUIRE(std::u32string(view.rbegin(), view.rend()) == std::u32string{U'z', 0x1F600, 0x20AC, 0xE9, U'a'});
+        REQUIRE(std::distance(view.begin(), view.end()) == 5);
+        REQUIRE(utf8::View{}.begin() == utf8::View{}.end());
+
+        // seeking moves back to the start of the code point
+        const struct final
+        {
+            std::size_t offset;
+            std::size_t position;
+            char32_t cp;
+        } seekCases[] = {
+            {0, 0, U'a'},
+            {1, 1, 0xE9},
+            {2, 1, 0xE9},
+            {5, 3, 0x20AC},
+            {9, 6, 0x1F600},
+            {10, 10, U'z'}
+        };
+
+        for (const auto& seekCase : seekCases)
+        {
+            const auto i = view.seek(seekCase.offset);
+            REQUIRE(i.offset() == seekCase.position);
+            REQUIRE(*i == seekCase.cp);
+        }
+        REQUIRE(view.seek(11) == view.end());
+        REQUIRE(view.seek(100) == view.end());
+
+        // every invalid byte is a code point of its own, in both directions
+        const std::string invalid = "a\xC3(\x80\xE2\x82\xC3\xA9\xA9\xF0\x9F\x98";
+        const std::u32string replaced = {U'a', 0xFFFD, U'(', 0xFFFD, 0xFFFD, 0xFFFD, 0xE9, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD};
+        const utf8::View replacing{invalid, true};
+        REQUIRE(std::u32string(replacing.begin(), replacing.end()) == replaced);
+        REQUIRE(std::u32string(replacing.rbegin(), replacing.rend()) == std::u32string(replaced.rbegin(), replaced.rend()));
+        REQUIRE(replacing.seek(7).offset() == 6);
+        REQUIRE(replacing.seek(8).offset() == 8);
+        REQUIRE_FALSE(replacing.seek(8).isValid());
+
+        const utf8::View strict{invalid};
+        auto i = strict.begin();
+        REQUIRE(*i++ == U'a');
+        REQUIRE_THROWS_AS(*i, utf8::ParseError);
+        REQUIRE(std::distance(strict.begin(), strict.end()) == static_cast<std::ptrdiff_t>(replaced.size()));
+    }
+
+    SECTION("UTF-16")
+    {
+        const struct final
+        {
+            std::string utf8;
+            std::u16string utf16;
+        } utf16Cases[] = {
+            {"", u""},
+            {"abc", u"abc"},
+            {"a\xC3\xA9\xE2\x82\xAC", {0x61, 0xE9, 0x20AC}},
+            {"\xF0\x9F\x98\x80z", {0xD83D, 0xDE00, 0x7A}},
+            {"\xF4\x8F\xBF\xBF", {0xDBFF, 0xDFFF}}
+        };
+
+        for (const auto& utf16Case : utf16Cases)
+        {
+            REQUIRE(utf8::toUtf16(utf16Case.utf8) == utf16Case.utf16);
+            REQUIRE(utf8::toUtf16(std::list<char>(utf16Case.utf8.begin(), utf16Case.utf8.end())) == utf16Case.utf16);
+            REQUIRE(utf8::fromUtf16(utf16Case.utf16) == utf16Case.utf8);
+            REQUIRE(utf8::fromUtf16(std::list<char16_t>(utf16Case.utf16.begin(), utf16Case.utf16.end())) == utf16Case.utf8);
+
+            const auto length = utf8::utf16Length(utf16Case.utf8.data(), utf16Case.utf8.size());
+            REQUIRE(length.error == utf8::Error::none);
+            REQUIRE(length.size == utf16Case.utf16.size());
+            REQUIRE(utf8::utf8Length(utf16Case.utf16.data(), utf16Case.utf16.size()).size == utf16Case.utf8.size());
+
+            // big-endian code units are byte-swapped on little-endian machines and the other way round
+            std::u16string swapped;
+            for (const char16_t unit : utf16Case.utf16)
+                swapped.push_back(static_cast<char16_t>((unit << 8) | (unit >> 8)));
+
+            std::u16string units(utf16Case.utf16.size(), u'\0');
+            const auto big = utf8::toUtf16<utf8::Endianness::big>(utf16Case.utf8.data(), utf16Case.utf8.size(),
+                                                                  &units[0], units.size());
+            REQUIRE(big.error == utf8::Error::none);
+            REQUIRE(big.size == units.size());
+            REQUIRE((utf8::Endianness::native == utf8::Endianness::big ? utf16Case.utf16 : swapped) == units);
+
+            std::string bytes(utf16Case.utf8.size(), '\0');
+            const auto fromBig = utf8::fromUtf16<utf8::Endianness::big>(units.data(), units.size(), &bytes[0], bytes.size());
+            REQUIRE(fromBig.error == utf8::Error::none);
+            REQUIRE(bytes == utf16Case.utf8);
+            REQUIRE(utf8::utf8Length<utf8::Endianness::big>(units.data(), units.size()).size == bytes.size());
+        }
+
+        // unpaired surrogates
+        for (const std::u16string& invalidCase : {std::u16string{0xD800}, std::u16string{0xDC00},
+                                                  std::u16string{0xD800, 0x41}, std::u16string{0xDBFF, 0xD800}})
+        {
+            REQUIRE_THROWS_AS(utf8::fromUtf16(invalidCase), utf8::ParseError);
+            REQUIRE_THROWS_AS(utf8::fromUtf16(std::list<char16_t>(invalidCase.begin(), invalidCase.end())), utf8::ParseError);
+
+            std::u16string text(64, u'a');
+            text.insert(40, invalidCase);
+            const auto length = utf8::utf8Length(text.data(), text.size());
+            REQUIRE(length.error == utf8::Error::invalidSequence);
+            REQUIRE(length.position == 40);
+            REQUIRE(length.size == 40);
+        }
+
+        REQUIRE_THROWS_AS(utf8::toUtf16(std::string("a\xED\xA0\x80")), utf8::ParseError);
+        const auto invalid = utf8::utf16Length("ab\xE2\x82", 4);
+        REQUIRE(invalid.error == utf8::Error::invalidSequence);
+        REQUIRE(invalid.position == 2);
+
+        // a full buffer stops at a code point boundary
+        char16_t units[3];
+        const auto partial = utf8::toUtf16("ab\xF0\x9F\x98\x80", 6, units, 3);
+        REQUIRE(partial.error == utf8::Error::outputTooSmall);
+        REQUIRE(partial.size == 2);
+        REQUIRE(partial.position == 2);
+
+        char bytes[4];
+        const auto partialBytes = utf8::fromUtf16(u"abc€", 4, bytes, 4);
+        REQUIRE(partialBytes.error == utf8::Error::outputTooSmall);
+        REQUIRE(partialBytes.size == 3);
+        REQUIRE(partialBytes.position == 3);
+
+        // long mixed text goes through the vectorized paths
+        std::string text;
+        for (std::size_t i = 0; i < 200; ++i)
+        {
+            text += std::string(i % 50, 'a');
+            text += utf8::fromUtf32(static_cast<char32_t>(i % 4 ? 0x80 + i * 997 % 0xD000 : 0x10000 + i * 4099));
+        }
+
+        const auto utf16String = utf8::toUtf16(text);
+        REQUIRE(utf16String == utf8::toUtf16(std::list<char>(text.begin(), text.end())));
+        REQUIRE(utf8::fromUtf16(utf16String) == text);
+        REQUIRE(utf8::fromUtf16(std::list<char16_t>(utf16String.begin(), utf16String.end())) == text);
+    }
+
+    SECTION("Normalization")
+    {
+        const struct final
+        {
+            std::u32string data;
+            std::u32string nfc;
+            std::u32string nfd;
+        } normalizationCases[] = {
+            {U"", U"", U""},
+            {U"abc", U"abc", U"abc"},
+            {U"\u00E9", U"\u00E9", U"e\u0301"},
+            {U"e\u0301", U"\u00E9", U"e\u0301"},
+            {U"\u212B", U"\u00C5", U"A\u030A"}, // singleton
+            {U"\u2126", U"\u03A9", U"\u03A9"}, // singleton
+            {U"\u0958", U"\u0915\u093C", U"\u0915\u093C"}, // composition exclusion
+            {U"a\u0307\u0323", U"\u1EA1\u0307", U"a\u0323\u0307"}, // canonical ordering
+            {U"a\u0301\u0301", U"\u00E1\u0301", U"a\u0301\u0301"}, // blocked
+            {U"\u0301a", U"\u0301a", U"\u0301a"}, // leading non-starter
+            {U"\u1E9B\u0323", U"\u1E9B\u0323", U"\u017F\u0323\u0307"},
+            {U"\uD55C\uAE00", U"\uD55C\uAE00", U"\u1112\u1161\u11AB\u1100\u1173\u11AF"}, // Hangul
+            {U"\u1112\u1161\u11AB", U"\uD55C", U"\u1112\u1161\u11AB"},
+            {U"\U0001D15E", U"\U0001D157\U0001D165", U"\U0001D157\U0001D165"}
+        };
+
+        for (const auto& normalizationCase : normalizationCases)
+        {
+            const auto text = utf8::fromUtf32(normalizationCase.data);
+            const auto nfc = utf8::fromUtf32(normalizationCase.nfc);
+            const auto nfd = utf8::fromUtf32(normalizationCase.nfd);
+
+            REQUIRE(utf8::normalize(text) == nfc);
+            REQUIRE(utf8::normalize(text, utf8::NormalizationForm::nfd) == nfd);
+            REQUIRE(utf8::normalize(nfd) == nfc);
+            REQUIRE(utf8::isNormalized(text) == (text == nfc));
+            REQUIRE(utf8::isNormalized(text, utf8::NormalizationForm::nfd) == (text == nfd));
+
+            // the normalized part in front is copied as is
+            const std::string prefix = "identifier \xC3\xA9 ";
+            REQUIRE(utf8::normalize(prefix + text) == prefix + nfc);
+        }
+
+        REQUIRE_THROWS_AS(utf8::normalize("e\xCC"), utf8::ParseError);
+        REQUIRE_THROWS_AS(utf8::isNormalized("\xFF"), utf8::ParseError);
+    }
+
+    SECTION("Case folding")
+    {
+        REQUIRE(utf8::foldCase(U'A') == U'a');
+        REQUIRE(utf8::foldCase(U'a') == U'a');
+        REQUIRE(utf8::foldCase(U'É') == U'é');
+        REQUIRE(utf8::foldCase(U'Σ') == U'σ');
+        REQUIRE(utf8::foldCase(U'ς') == U'σ');
+        REQUIRE(utf8::foldCase(U'ẞ') == U'ß'); // simple folding keeps one code point
+        REQUIRE(utf8::foldCase(U'İ') == U'İ'); // only has a full or Turkic folding
+        REQUIRE(utf8::foldCase(U'\U00010400') == U'\U00010428');
+        REQUIRE(utf8::foldCase(U'\U0010FFFF') == U'\U0010FFFF');
+
+        REQUIRE(utf8::foldCase("Hello, World!") == "hello, world!");
+        REQUIRE(utf8::foldCase(utf8::fromUtf32(std::u32string(U"\u212A\u0130\u0100\u023A\u039F\u0394\u03A5\u03A3\u03A3\u0395\u0399\u0391\u03A3"))) ==
+                utf8::fromUtf32(std::u32string(U"k\u0130\u0101\u2C65\u03BF\u03B4\u03C5\u03C3\u03C3\u03B5\u03B9\u03B1\u03C3")));
+        REQUIRE_THROWS_AS(utf8::foldCase("A\xC3"), utf8::ParseError);
+    }
 }
 
 namespace
@@ -694,4 +1836,255 @@ TEST_CASE("UUID", "[uuid]")
     REQUIRE(s.length() == 36);
     REQUIRE(s[14] == '4');
     REQUIRE((hexToInt(s[19]) & 0x0CU) == 0x08U);
+
+    SECTION("Threads")
+    {
+        // every thread has its own engine, so the identifiers must still be unique
+        std::vector<std::vector<std::string>> results(4);
+        std::vector<std::thread> threads;
+        for (auto& result : results)
+            threads.emplace_back([&result]() {
+                for (std::size_t i = 0; i < 1000; ++i)
+                    result.push_back(uuid::generate<std::string>());
+            });
+
+        for (auto& thread : threads)
+            thread.join();
+
+        std::vector<std::string> all;
+        for (const auto& result : results)
+            all.insert(all.end(), result.begin(), result.end());
+
+        std::sort(all.begin(), all.end());
+        REQUIRE(std::adjacent_find(all.begin(), all.end()) == all.end());
+        REQUIRE(all.size() == 4000);
+    }
+
+    SECTION("Engine")
+    {
+        uuid::Xoshiro256 engine{0};
+        REQUIRE(engine() == 0x99EC5F36CB75F2B4U);
+        REQUIRE(engine() == 0xBF6E1F784956452AU);
+        REQUIRE(engine() == 0x1A5F849D4933E6E0U);
+
+        // the same seed gives the same identifiers, a 32-bit engine is called twice per 64 bits
+        uuid::Xoshiro256 first{42};
+        uuid::Xoshiro256 second{42};
+        REQUIRE(uuid::generate<std::string>(first) == uuid::generate<std::string>(second));
+
+        std::mt19937 mt{1};
+        const auto bytes = uuid::generate<std::array<std::uint8_t, 16>>(mt);
+        REQUIRE(bytes[6] >> 4 == 4);
+        REQUIRE((bytes[8] & 0xC0U) == 0x80U);
+    }
+
+    SECTION("Bulk")
+    {
+        std::vector<std::array<std::uint8_t, 16>> uuids(1000);
+        uuid::generateN(uuids.data(), uuids.size());
+
+        for (const auto& u : uuids)
+        {
+            REQUIRE(u[6] >> 4 == 4);
+            REQUIRE((u[8] & 0xC0U) == 0x80U);
+        }
+
+        std::sort(uuids.begin(), uuids.end());
+        REQUIRE(std::adjacent_find(uuids.begin(), uuids.end()) == uuids.end());
+
+        // bulk generation matches one by one generation from the same engine
+        uuid::Xoshiro256 first{7};
+        uuid::Xoshiro256 second{7};
+        std::array<std::uint8_t, 16> bulk[3];
+        uuid::generateN(bulk, 3, first);
+        for (const auto& u : bulk)
+            REQUIRE(u == uuid::generate<std::array<std::uint8_t, 16>>(second));
+    }
+
+    SECTION("Time-ordered")
+    {
+        const auto now = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+
+        const auto v7 = uuid::generateV7<std::array<std::uint8_t, 16>>();
+        REQUIRE(v7[6] >> 4 == 7);
+        REQUIRE((v7[8] & 0xC0U) == 0x80U);
+
+        std::uint64_t milliseconds = 0;
+        for (std::size_t i = 0; i < 6; ++i) milliseconds = (milliseconds << 8) | v7[i];
+        REQUIRE(milliseconds >= now);
+        REQUIRE(milliseconds < now + 60000);
+
+        const auto v6 = uuid::generateV6<std::string>();
+        REQUIRE(v6.length() == 36);
+        REQUIRE(v6[14] == '6');
+        REQUIRE((hexToInt(v6[19]) & 0x0CU) == 0x08U);
+
+        // strictly increasing within the process, also when generated from several threads
+        for (const bool v7Order : {true, false})
+        {
+            std::vector<std::vector<std::string>> results(4);
+            std::vector<std::thread> threads;
+            for (auto& result : results)
+                threads.emplace_back([&result, v7Order]() {
+                    for (std::size_t i = 0; i < 5000; ++i)
+                        result.push_back(v7Order ? uuid::generateV7<std::string>() : uuid::generateV6<std::string>());
+                });
+
+            for (auto& thread : threads)
+                thread.join();
+
+            std::vector<std::string> all;
+            for (const auto& result : results)
+            {
+                REQUIRE(std::adjacent_find(result.begin(), result.end(), std::greater_equal<>()) == result.end());
+                all.insert(all.end(), result.begin(), result.end());
+            }
+
+            std::sort(all.begin(), all.end());
+            REQUIRE(std::adjacent_find(all.begin(), all.end()) == all.end());
+        }
+    }
+
+    SECTION("Name-based")
+    {
+        const struct final
+        {
+            std::array<std::uint8_t, 16> namespaceId;
+            std::string name;
+            std::string v3;
+            std::string v5;
+        } nameCases[] = {
+            {uuid::dnsNamespace, "www.example.com", "5df41881-3aed-3515-88a7-2f4a814cf09e", "2ed6657d-e927-568b-95e1-2665a8aea6a2"},
+            {uuid::urlNamespace, "https://example.com/a", "", "6639460f-3425-5329-8097-a58f06127860"},
+            {uuid::oidNamespace, "1.3.6.1", "dd1a1cef-13d5-368a-ad82-eca71acd4cd1", ""},
+            {uuid::x500Namespace, "cn=John", "", "1713550e-4d56-5817-bce4-d5dac105f99d"}
+        };
+
+        for (const auto& nameCase : nameCases)
+        {
+            if (!nameCase.v3.empty())
+                REQUIRE(uuid::generateV3<std::string>(nameCase.namespaceId, nameCase.name) == nameCase.v3);
+            if (!nameCase.v5.empty())
+                REQUIRE(uuid::generateV5<std::string>(nameCase.namespaceId, nameCase.name) == nameCase.v5);
+        }
+
+        // string literals are hashed without the terminating zero, other ranges as they are
+        REQUIRE(uuid::generateV5<std::string>(uuid::dnsNamespace, "www.example.com") == "2ed6657d-e927-568b-95e1-2665a8aea6a2");
+        const std::vector<std::uint8_t> bytes = {'w', 'w', 'w', '.', 'e', 'x', 'a', 'm', 'p', 'l', 'e', '.', 'c', 'o', 'm'};
+        REQUIRE(uuid::generateV3<std::string>(uuid::dnsNamespace, bytes) == "5df41881-3aed-3515-88a7-2f4a814cf09e");
+
+        const uuid::NameGeneratorV5 generator{uuid::dnsNamespace};
+        for (const std::string name : {"a", "www.example.com", "a.much.longer.name.that.spans.more.than.one.hash.block.example.com"})
+        {
+            const auto u = generator.generate<std::array<std::uint8_t, 16>>(name);
+            REQUIRE(u == uuid::generateV5<std::array<std::uint8_t, 16>>(uuid::dnsNamespace, name));
+            REQUIRE(u[6] >> 4 == 5);
+            REQUIRE((u[8] & 0xC0U) == 0x80U);
+        }
+    }
+
+    SECTION("Parsing")
+    {
+        const struct final
+        {
+            std::string input;
+            uuid::Error error;
+            std::size_t position;
+        } parseCases[] = {
+            {"2ed6657d-e927-568b-95e1-2665a8aea6a2", uuid::Error::none, 36},
+            {"2ED6657D-E927-568B-95E1-2665A8AEA6A2", uuid::Error::none, 36},
+            {"2ed6657de927568b95e12665a8aea6a2", uuid::Error::none, 32},
+            {"2ed6657d-e927-568b-95e1-2665a8aea6a", uuid::Error::invalidLength, 35},
+            {"", uuid::Error::invalidLength, 0},
+            {"2ed6657d_e927-568b-95e1-2665a8aea6a2", uuid::Error::invalidCharacter, 8},
+            {"2ed6657d-e927-568b-95e12665a8aea6a2-", uuid::Error::invalidCharacter, 23},
+            {"2ed6657d-e927-568b-95e1-2665a8aea6g2", uuid::Error::invalidCharacter, 34},
+            {"2ed6657d-e9z7-568b-95e1-2665a8aea6a2", uuid::Error::invalidCharacter, 11},
+            {"x2ed6657de927568b95e12665a8aea6a2", uuid::Error::invalidLength, 33},
+            {"2ed6657de927568b95e12665a8aea6a ", uuid::Error::invalidCharacter, 31}
+        };
+
+        for (const auto& parseCase : parseCases)
+        {
+            uuid::Value value{1, 2};
+            const auto result = uuid::parse(parseCase.input.data(), parseCase.input.size(), value);
+            REQUIRE(result.error == parseCase.error);
+            REQUIRE(result.position == parseCase.position);
+
+            if (parseCase.error == uuid::Error::none)
+            {
+                REQUIRE(value == uuid::Value{0x2ED6657DE927568BU, 0x95E12665A8AEA6A2U});
+                REQUIRE(uuid::parse<std::string>(parseCase.input) == "2ed6657d-e927-568b-95e1-2665a8aea6a2");
+            }
+            else
+            {
+                REQUIRE(value == uuid::Value{1, 2});
+                REQUIRE_THROWS_AS(uuid::parse(parseCase.input), uuid::ParseError);
+            }
+        }
+
+        for (int i = 0; i < 100; ++i)
+        {
+            const auto u = uuid::generate();
+            const auto s = uuid::generate<std::string>();
+            REQUIRE(uuid::parse(uuid::convert<std::string>(u)) == u);
+            REQUIRE(uuid::parse<std::string>(s) == s);
+            std::string digits = s;
+            digits.erase(std::remove(digits.begin(), digits.end(), '-'), digits.end());
+            REQUIRE(hex::encode(uuid::parse<std::array<std::uint8_t, 16>>(s)) == digits);
+            REQUIRE(uuid::parse<uuid::Value>(digits) == uuid::parse<uuid::Value>(s));
+        }
+    }
+
+    SECTION("Characters")
+    {
+        const uuid::Value value{0x2ED6657DE927568BU, 0x95E12665A8AEA6A2U};
+
+        char buffer[uuid::stringLength + 1] = {};
+        REQUIRE(uuid::toChars(value, buffer) == buffer + uuid::stringLength);
+        REQUIRE(std::string{buffer} == "2ed6657d-e927-568b-95e1-2665a8aea6a2");
+        REQUIRE(buffer[uuid::stringLength] == '\0');
+
+        uuid::toChars(uuid::parse(std::string_view{buffer}), buffer, true);
+        REQUIRE(std::string{buffer} == "2ED6657D-E927-568B-95E1-2665A8AEA6A2");
+    }
+
+    SECTION("Comparison and hashing")
+    {
+        uuid::Xoshiro256 engine{3};
+        std::vector<std::string> strings;
+        std::map<uuid::Value, std::string> ordered;
+        std::unordered_map<uuid::Value, std::string> unordered;
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            const auto s = i % 2 ? uuid::generate<std::string>(engine) : uuid::generateV7<std::string>(engine);
+            strings.push_back(s);
+            ordered[uuid::parse<uuid::Value>(s)] = s;
+            unordered[uuid::parse<uuid::Value>(s)] = s;
+        }
+
+        // the order of the values matches the order of the strings
+        std::sort(strings.begin(), strings.end());
+        REQUIRE(ordered.size() == strings.size());
+        auto i = strings.begin();
+        for (const auto& entry : ordered)
+            REQUIRE(entry.second == *i++);
+
+        for (const auto& s : strings)
+            REQUIRE(unordered.at(uuid::parse<uuid::Value>(s)) == s);
+
+        const auto first = uuid::parse("00000000-0000-0000-0000-000000000001");
+        const auto second = uuid::parse("00000000-0000-0000-0100-000000000000");
+        const auto third = uuid::parse("00000001-0000-0000-0000-000000000000");
+        REQUIRE(first < second);
+        REQUIRE(second < third);
+        REQUIRE(third > first);
+        REQUIRE(first <= first);
+        REQUIRE(first >= first);
+        REQUIRE(first != second);
+        REQUIRE(first == uuid::parse("00000000000000000000000000000001"));
+        REQUIRE(std::hash<uuid::Uuid>{}(first) == std::hash<uuid::Value>{}(uuid::convert<uuid::Value>(first)));
+    }
 }